@@ -0,0 +1,212 @@
+/**
+ * @file aggregate.c
+ * @brief 增量聚合检查：zerolist_set_monoid / zerolist_aggregate
+ *
+ * 分别以可逆可交换（求和）、不可逆（最大值）、不可交换（仿射变换复合）三种幺半群，
+ * 对链表执行随机插入、删除、反转、提取、清空，每步把汇总值与逐个遍历的结果比较；
+ * 并确认设置幺半群时不遍历、队列式尾进头出的取值次数为均摊 O(1)。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：aggregate
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES  128
+#define VALUE_COUNT 100
+#define STEPS       20000
+#define QUEUE_LEN   40
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[VALUE_COUNT];
+static long     extracts;  // extract 调用次数
+static unsigned seed = 31u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+ZEROLIST_DEFINE(side, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static ZEROLIST_AGG_TYPE get_value(const void* data)
+{
+    extracts++;
+    return *(const int*)data;
+}
+
+static ZEROLIST_AGG_TYPE add(ZEROLIST_AGG_TYPE a, ZEROLIST_AGG_TYPE b)
+{
+    return a + b;
+}
+
+static ZEROLIST_AGG_TYPE sub(ZEROLIST_AGG_TYPE acc, ZEROLIST_AGG_TYPE v)
+{
+    return acc - v;
+}
+
+static ZEROLIST_AGG_TYPE max_of(ZEROLIST_AGG_TYPE a, ZEROLIST_AGG_TYPE b)
+{
+    return a > b ? a : b;
+}
+
+// 仿射变换 x -> a*x + b（模 2^32），打包为 a << 32 | b；compose(f, g) 表示先 f 后 g
+static ZEROLIST_AGG_TYPE compose(ZEROLIST_AGG_TYPE f, ZEROLIST_AGG_TYPE g)
+{
+    uint32_t fa = (uint32_t)((uint64_t)f >> 32), fb = (uint32_t)f;
+    uint32_t ga = (uint32_t)((uint64_t)g >> 32), gb = (uint32_t)g;
+    return (ZEROLIST_AGG_TYPE)(((uint64_t)(ga * fa) << 32) | (uint32_t)(ga * fb + gb));
+}
+
+static ZEROLIST_AGG_TYPE get_affine(const void* data)
+{
+    extracts++;
+    uint32_t x = (uint32_t)*(const int*)data;
+    return (ZEROLIST_AGG_TYPE)(((uint64_t)(x * 2u + 1u) << 32) | (x + 3u));
+}
+
+static const zerolist_monoid_t monoids[] = {
+    { 0, add, get_value, sub, true },
+    { -1, max_of, get_value, NULL, true },
+    { (ZEROLIST_AGG_TYPE)(1ULL << 32), compose, get_affine, NULL, false },
+};
+
+#define MONOID_COUNT ((int)(sizeof(monoids) / sizeof(monoids[0])))
+
+// 逐个遍历计算的参考值，不计入 extracts
+static ZEROLIST_AGG_TYPE reference(Zerolist* l, const zerolist_monoid_t* m)
+{
+    long              saved = extracts;
+    ZEROLIST_AGG_TYPE acc   = m->identity;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        acc = m->combine(acc, m->extract(node->data));
+    }
+    extracts = saved;
+    return acc;
+}
+
+static void* random_value(void)
+{
+    return &values[next_rand(VALUE_COUNT)];
+}
+
+static void random_step(const zerolist_monoid_t* m)
+{
+    int size = (int)zerolist_size(&list);
+    int op   = next_rand(10);
+    if (op < 4 && size >= POOL_NODES - 1) op = 5;
+    switch (op) {
+    case 0:
+    case 1:
+        zerolist_push_back(&list, random_value());
+        break;
+    case 2:
+        zerolist_push_front(&list, random_value());
+        break;
+    case 3:
+        if (size) {
+            zerolist_insert_before(&list, zerolist_at(&list, (ZEROLIST_TYPE)next_rand(size)),
+                                   random_value());
+        }
+        break;
+    case 4:
+        zerolist_pop_front(&list);
+        break;
+    case 5:
+        zerolist_pop_back(&list);
+        break;
+    case 6:
+        if (size) zerolist_remove_at(&list, (ZEROLIST_TYPE)next_rand(size));
+        break;
+    case 7:
+        if (next_rand(20) == 0) zerolist_reverse(&list);
+        break;
+    case 8:
+        if (size > 2 && next_rand(5) == 0) {
+            zerolist_clear(&side);
+            zerolist_extract_range(&list, 0, (ZEROLIST_TYPE)next_rand(size), &side);
+            CHECK(zerolist_aggregate(&side) == reference(&side, m));
+        }
+        break;
+    default:
+        if (next_rand(50) == 0) zerolist_clear(&list);
+        break;
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+    ZEROLIST_INIT(side);
+    for (int i = 0; i < VALUE_COUNT; i++) {
+        values[i] = next_rand(1000) - 500;
+    }
+
+    for (int mi = 0; mi < MONOID_COUNT && !errors; mi++) {
+        const zerolist_monoid_t* m = &monoids[mi];
+
+        // 1. 设置幺半群不遍历，第一次查询时计算
+        zerolist_clear(&list);
+        zerolist_set_monoid(&list, NULL);
+        for (int i = 0; i < QUEUE_LEN; i++) {
+            zerolist_push_back(&list, &values[i]);
+        }
+        extracts = 0;
+        zerolist_set_monoid(&list, m);
+        zerolist_set_monoid(&side, m);
+        CHECK(extracts == 0);
+        CHECK(zerolist_aggregate(&list) == reference(&list, m));
+        CHECK(extracts == QUEUE_LEN);
+
+        // 2. 随机操作后汇总值与参考值一致
+        for (int step = 0; step < STEPS && !errors; step++) {
+            random_step(m);
+            if (next_rand(3) == 0) CHECK(zerolist_aggregate(&list) == reference(&list, m));
+        }
+
+        // 3. 原地修改数据后需要显式失效
+        zerolist_clear(&list);
+        CHECK(zerolist_aggregate(&list) == m->identity);
+        zerolist_push_back(&list, &values[0]);
+        zerolist_push_back(&list, &values[1]);
+        zerolist_aggregate(&list);
+        values[1] += 7;
+        zerolist_aggregate_invalidate(&list);
+        CHECK(zerolist_aggregate(&list) == reference(&list, m));
+        values[1] -= 7;
+        zerolist_aggregate_invalidate(&list);
+
+        // 4. 尾进头出：每次操作的取值次数均摊为常数
+        zerolist_clear(&list);
+        for (int i = 0; i < QUEUE_LEN; i++) {
+            zerolist_push_back(&list, &values[i]);
+        }
+        zerolist_aggregate(&list);
+        extracts = 0;
+        for (int i = 0; i < STEPS; i++) {
+            zerolist_pop_front(&list);
+            zerolist_push_back(&list, &values[i % VALUE_COUNT]);
+            CHECK(zerolist_aggregate(&list) == reference(&list, m));
+        }
+        CHECK(extracts < STEPS * 3);
+    }
+
+    zerolist_destroy(&list);
+    zerolist_destroy(&side);
+    printf("aggregate: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file array.c
+ * @brief 数组批量转换检查：zerolist_to_array / zerolist_from_array
+ *
+ * 对随机修改（含反转）后的链表导出数组并与参考模型比较（含容量小于长度的截断），
+ * 再用随机数组重建链表；确认内容与顺序一致、静态模式下节点按顺序铺设在节点池前部、
+ * 重建后剩余槽位仍可正常分配，纯静态模式下容量不足时链表保持原样。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：array
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 48
+#define ROUNDS     3000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[POOL_NODES * 2];
+static void*    model[POOL_NODES * 2];  // 参考模型，按链表逻辑顺序
+static int      model_len;
+static void*    out[POOL_NODES * 2];
+static unsigned seed = 97u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static void check_model(void)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        CHECK(i < model_len && node->data == model[i]);
+        i++;
+    }
+    CHECK(i == model_len && (int)zerolist_size(&list) == model_len);
+}
+
+static void mutate(int steps)
+{
+    for (int k = 0; k < steps; k++) {
+        int op = next_rand(5);
+        if (op < 2 && model_len < POOL_NODES) {
+            void* data = &values[next_rand(POOL_NODES * 2)];
+            CHECK(zerolist_push_front(&list, data));
+            for (int i = model_len; i > 0; i--) {
+                model[i] = model[i - 1];
+            }
+            model[0] = data;
+            model_len++;
+        } else if (op == 2 && model_len) {
+            int i = next_rand(model_len);
+            zerolist_remove_at(&list, (ZEROLIST_TYPE)i);
+            for (; i + 1 < model_len; i++) {
+                model[i] = model[i + 1];
+            }
+            model_len--;
+        } else if (op == 3) {
+            zerolist_reverse(&list);
+            for (int i = 0; i < model_len / 2; i++) {
+                void* t                  = model[i];
+                model[i]                 = model[model_len - 1 - i];
+                model[model_len - 1 - i] = t;
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+
+    // 1. 空链表与无效参数
+    CHECK(zerolist_to_array(&list, out, POOL_NODES) == 0);
+    CHECK(zerolist_from_array(&list, NULL, 0));
+    CHECK(!zerolist_from_array(&list, NULL, 4));
+
+    for (int r = 0; r < ROUNDS && !errors; r++) {
+        mutate(1 + next_rand(24));
+        check_model();
+
+        // 2. 导出：按逻辑顺序，容量不足时截断
+        int cap = next_rand(POOL_NODES + 4);
+        int n   = (int)zerolist_to_array(&list, out, (ZEROLIST_TYPE)cap);
+        CHECK(n == (cap < model_len ? cap : model_len));
+        for (int i = 0; i < n; i++) {
+            CHECK(out[i] == model[i]);
+        }
+
+        // 3. 重建：内容与数组一致，静态模式下逻辑顺序即物理顺序
+        if (next_rand(3) == 0) continue;
+        int count = next_rand(POOL_NODES + 1);
+        for (int i = 0; i < count; i++) {
+            out[i] = &values[next_rand(POOL_NODES * 2)];
+        }
+        CHECK(zerolist_from_array(&list, out, (ZEROLIST_TYPE)count));
+        for (int i = 0; i < count; i++) {
+            model[i] = out[i];
+        }
+        model_len = count;
+        check_model();
+#if !ZEROLIST_USE_MALLOC
+        int slot = 0;
+        ZEROLIST_FOR_EACH(&list, node)
+        {
+            CHECK(node == &list.node_buf[slot]);
+            slot++;
+        }
+#endif
+    }
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 4. 纯静态模式：容量不足时失败且链表保持原样；剩余槽位恰好都能分配
+    for (int i = 0; i <= POOL_NODES; i++) {
+        out[i] = &values[i];
+    }
+    CHECK(!zerolist_from_array(&list, out, POOL_NODES + 1));
+    check_model();
+    CHECK(zerolist_from_array(&list, out, POOL_NODES / 2));
+    for (int i = POOL_NODES / 2; i < POOL_NODES; i++) {
+        CHECK(zerolist_push_back(&list, &values[i]));
+    }
+    CHECK(!zerolist_push_back(&list, &values[0]));
+    CHECK(zerolist_to_array(&list, out, POOL_NODES * 2) == POOL_NODES);
+    for (int i = 0; i < POOL_NODES; i++) {
+        CHECK(out[i] == &values[i]);
+    }
+#endif
+
+    zerolist_destroy(&list);
+    printf("array: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
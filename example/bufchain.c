@@ -0,0 +1,123 @@
+/**
+ * @file bufchain.c
+ * @brief 缓冲区链检查：zerolist_push_back_buf / zerolist_to_iovec / zerolist_consume
+ *
+ * 模拟 writev 的部分发送：每轮导出 iovec、随机决定本次发送的字节数并消费，
+ * 确认发送出的字节序列与写入顺序一致、缓冲区按发送完的先后释放；
+ * 并确认 0 字节的消费不修改链表。任何不一致都以非零退出码结束。
+ *
+ * 用法：bufchain
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 32
+#define BUF_COUNT  200
+#define BUF_MAX    24
+#define IOV_MAX_N  8
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static uint8_t  bufs[BUF_COUNT][BUF_MAX];
+static size_t   lens[BUF_COUNT];
+static int      released;  // 已释放的缓冲区个数，也是下一个应释放的下标
+static unsigned seed = 5u;
+static int      errors;
+
+ZEROLIST_DEFINE(chain, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static void on_release(void* buf, void* ctx)
+{
+    (void)ctx;
+    CHECK(released < BUF_COUNT && buf == bufs[released]);
+    released++;
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(chain);
+
+    // 缓冲区内容为全局字节序号，其中约 1/5 为空缓冲区
+    uint8_t total = 0;
+    for (int i = 0; i < BUF_COUNT; i++) {
+        lens[i] = next_rand(5) == 0 ? 0 : (size_t)next_rand(BUF_MAX) + 1;
+        for (size_t k = 0; k < lens[i]; k++) {
+            bufs[i][k] = total++;
+        }
+    }
+
+    // 1. 0 字节的消费不移除头部的空缓冲区
+    CHECK(zerolist_push_back_buf(&chain, bufs[0], 0));
+    CHECK(zerolist_consume(&chain, 0, on_release, NULL) == 0);
+    CHECK(chain.head != NULL && released == 0);
+    CHECK(!zerolist_push_back_buf(&chain, NULL, 4));
+    zerolist_clear(&chain);
+
+    // 2. 随机部分发送：发送出的字节按写入顺序连续
+    int     pushed = 0;
+    uint8_t expect = 0;
+    while (released < BUF_COUNT && !errors) {
+        while (pushed < BUF_COUNT && (int)zerolist_size(&chain) < POOL_NODES && next_rand(2)) {
+            CHECK(zerolist_push_back_buf(&chain, bufs[pushed], lens[pushed]));
+            pushed++;
+        }
+        if (zerolist_pending_bytes(&chain) == 0) {
+            // 只剩空缓冲区：任意非零字节数把它们全部消费掉
+            CHECK(zerolist_consume(&chain, 1, on_release, NULL) == 0);
+            CHECK(chain.head == NULL);
+            continue;
+        }
+
+        struct iovec iov[IOV_MAX_N];
+        int          n       = zerolist_to_iovec(&chain, iov, IOV_MAX_N);
+        size_t       offered = 0;
+        for (int i = 0; i < n; i++) {
+            CHECK(iov[i].iov_len > 0);
+            offered += iov[i].iov_len;
+        }
+        CHECK(offered <= zerolist_pending_bytes(&chain));
+
+        size_t sent = (size_t)next_rand((int)offered + 1);
+        size_t left = sent;
+        for (int i = 0; i < n && left; i++) {
+            size_t part = iov[i].iov_len < left ? iov[i].iov_len : left;
+            for (size_t k = 0; k < part; k++) {
+                CHECK(((const uint8_t*)iov[i].iov_base)[k] == expect);
+                expect++;
+            }
+            left -= part;
+        }
+
+        size_t before = zerolist_pending_bytes(&chain);
+        CHECK(zerolist_consume(&chain, sent, on_release, NULL) == sent);
+        CHECK(zerolist_pending_bytes(&chain) == before - sent);
+    }
+    CHECK(released == BUF_COUNT);
+    CHECK(expect == total);
+
+    // 3. 请求的字节数超过待发送数据：返回实际消费量并清空链表
+    released = 0;
+    CHECK(zerolist_push_back_buf(&chain, bufs[0], lens[0]));
+    CHECK(zerolist_push_back_buf(&chain, bufs[1], lens[1]));
+    CHECK(zerolist_consume(&chain, (size_t)-1, on_release, NULL) == lens[0] + lens[1]);
+    CHECK(chain.head == NULL && released == 2);
+
+    zerolist_destroy(&chain);
+    printf("bufchain: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file chan.c
+ * @brief 对象回收通道检查：zerolist_chan_* 单条与整批接口
+ *
+ * 随机交替执行 acquire/submit/receive/recycle 及其整批版本，生产者在缓冲区中写入
+ * 递增的消息序号；确认消费者按提交顺序收到消息、任何时刻同一缓冲区只有一个持有者、
+ * 空闲 + 就绪 + 持有的缓冲区总数守恒。任何不一致都以非零退出码结束。
+ *
+ * 用法：chan
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define NODE_COUNT 16
+#define BUF_SIZE   32
+#define STEPS      20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static zerolist_cqueue_t producing;  // 生产者持有、尚未提交
+static zerolist_cqueue_t consuming;  // 消费者持有、尚未归还
+static uint32_t          written;    // 下一条写入的消息序号
+static uint32_t          expected;   // 下一条应收到的消息序号
+static unsigned          seed = 41u;
+static int               errors;
+
+ZEROLIST_CHAN_DEFINE(chan, NODE_COUNT, BUF_SIZE);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+// 批次尾部追加（批次由本程序独占）
+static void cqueue_push(zerolist_cqueue_t* q, zerolist_cnode_t* node)
+{
+    node->next = NULL;
+    if (q->tail) {
+        q->tail->next = node;
+    } else {
+        q->head = node;
+    }
+    q->tail = node;
+    q->count++;
+}
+
+static void fill(zerolist_cnode_t* node)
+{
+    CHECK((uint8_t*)node->data >= (uint8_t*)chan_bufs
+          && (uint8_t*)node->data < (uint8_t*)chan_bufs + sizeof(chan_bufs));
+    *(uint32_t*)node->data = written++;
+    node->len              = sizeof(uint32_t);
+}
+
+static void take(zerolist_cnode_t* node)
+{
+    CHECK(node->len == sizeof(uint32_t));
+    CHECK(*(const uint32_t*)node->data == expected);
+    expected++;
+}
+
+// 所有缓冲区互不相同，且总数守恒
+static void check_conservation(void)
+{
+    CHECK(zerolist_chan_free_count(&chan) + zerolist_chan_ready_count(&chan) + producing.count
+              + consuming.count
+          == NODE_COUNT);
+    int seen[NODE_COUNT] = { 0 };
+    ZEROLIST_CQUEUE_FOR_EACH(&producing, node)
+    {
+        seen[node - chan_nodes]++;
+    }
+    ZEROLIST_CQUEUE_FOR_EACH(&consuming, node)
+    {
+        seen[node - chan_nodes]++;
+    }
+    for (int i = 0; i < NODE_COUNT; i++) {
+        CHECK(seen[i] <= 1);
+    }
+}
+
+int main(void)
+{
+    CHECK(ZEROLIST_CHAN_INIT(chan));
+    CHECK(zerolist_chan_free_count(&chan) == NODE_COUNT);
+    CHECK(zerolist_chan_receive(&chan) == NULL);
+
+    for (int step = 0; step < STEPS && !errors; step++) {
+        zerolist_cnode_t* node;
+        zerolist_cqueue_t batch = { NULL, NULL, 0 };
+        switch (next_rand(8)) {
+        case 0:
+            // 单条生产：取出即填充，按取出顺序留在 producing 中等待提交
+            node = zerolist_chan_acquire(&chan);
+            if (node) {
+                fill(node);
+                cqueue_push(&producing, node);
+            }
+            break;
+        case 1:
+            // 按填充顺序提交最早的一条
+            node = zerolist_cqueue_pop(&producing);
+            if (node) zerolist_chan_submit(&chan, node);
+            break;
+        case 2:
+            // 整批生产：先提交已持有的，再整批取出、填充、提交
+            zerolist_chan_submit_batch(&chan, &producing);
+            CHECK(producing.head == NULL && producing.count == 0);
+            zerolist_chan_acquire_batch(&chan, &batch, (size_t)next_rand(NODE_COUNT) + 1);
+            ZEROLIST_CQUEUE_FOR_EACH(&batch, n)
+            {
+                fill(n);
+            }
+            zerolist_chan_submit_batch(&chan, &batch);
+            CHECK(batch.head == NULL && batch.count == 0);
+            break;
+        case 3:
+        case 4:
+            node = zerolist_chan_receive(&chan);
+            if (node) {
+                take(node);
+                cqueue_push(&consuming, node);
+            }
+            break;
+        case 5:
+            node = zerolist_cqueue_pop(&consuming);
+            if (node) zerolist_chan_recycle(&chan, node);
+            break;
+        case 6: {
+            size_t before = consuming.count;
+            size_t ready  = zerolist_chan_ready_count(&chan);
+            CHECK(zerolist_chan_receive_all(&chan, &consuming) == ready);
+            CHECK(consuming.count == before + ready && zerolist_chan_ready_count(&chan) == 0);
+            node = consuming.head;
+            for (size_t i = 0; i < before; i++) {
+                node = node->next;
+            }
+            for (; node; node = node->next) {
+                take(node);
+            }
+            break;
+        }
+        default:
+            zerolist_chan_recycle_batch(&chan, &consuming);
+            CHECK(consuming.head == NULL && consuming.count == 0);
+            break;
+        }
+        check_conservation();
+    }
+    CHECK(expected + zerolist_chan_ready_count(&chan) + producing.count == written);
+
+    printf("chan: %u messages, %s\n", (unsigned)expected, errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file clear_step.c
+ * @brief 分步清空检查：zerolist_clear_step / zerolist_destroy_step
+ *
+ * 以随机预算分步清空链表，并在回收过程中继续插入与再次清空；确认第一次调用后链表
+ * 立即为空、每次调用至多回收 budget 个节点、调用次数与待回收节点数相符；纯静态模式下
+ * 逐步核对空闲槽位数，开启布隆过滤器时确认回收完毕后计数全部归零。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：clear_step
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 64
+#define ROUNDS     2000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[POOL_NODES];
+static unsigned seed = 83u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static int reclaim_count(const Zerolist* l)
+{
+    int n = 0;
+    if (l->reclaim) {
+        const zerolist_node_t* cur = l->reclaim;
+        do {
+            n++;
+            cur = cur->next;
+        } while (cur != l->reclaim);
+    }
+    return n;
+}
+
+static void fill(int count)
+{
+    for (int i = 0; i < count; i++) {
+        CHECK(zerolist_push_back(&list, &values[next_rand(POOL_NODES)]));
+    }
+}
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+// 纯静态模式：链表与待回收环之外的槽位恰好都能分配，且再多一个就失败
+static void check_free_slots(void)
+{
+    int used = (int)zerolist_size(&list) + reclaim_count(&list);
+    int room = POOL_NODES - used;
+    for (int i = 0; i < room; i++) {
+        CHECK(zerolist_push_front(&list, &values[0]));
+    }
+    CHECK(!zerolist_push_front(&list, &values[0]));
+    for (int i = 0; i < room; i++) {
+        zerolist_pop_front(&list);
+    }
+}
+#else
+static void check_free_slots(void) {}
+#endif
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+
+    // 1. 空链表：无事可做
+    CHECK(!zerolist_clear_step(&list, 4));
+    CHECK(!zerolist_clear_step(NULL, 4));
+
+    for (int r = 0; r < ROUNDS && !errors; r++) {
+        int n = 1 + next_rand(POOL_NODES / 2);
+        fill(n);
+        int pending = reclaim_count(&list);
+
+        // 2. 预算为 0：只摘链不回收，链表立即为空且可继续插入
+        CHECK(zerolist_clear_step(&list, 0));
+        CHECK(list.head == NULL && zerolist_size(&list) == 0);
+        pending += n;
+        CHECK(reclaim_count(&list) == pending);
+        check_free_slots();
+
+        // 3. 回收中途插入新数据，再次调用时一并并入待回收环
+        int budget = 1 + next_rand(8);
+        int calls  = 0;
+        while (pending) {
+            if (next_rand(4) == 0 && pending + (int)zerolist_size(&list) < POOL_NODES - 4) {
+                int extra = 1 + next_rand(4);
+                fill(extra);
+#if ZEROLIST_BLOOM_ENABLE
+                ZEROLIST_FOR_EACH(&list, node)
+                {
+                    CHECK(zerolist_may_contain(&list, node->data));
+                }
+#endif
+                pending += extra;
+            }
+            bool more = zerolist_clear_step(&list, (ZEROLIST_TYPE)budget);
+            int  done = pending < budget ? pending : budget;
+            pending -= done;
+            calls++;
+            CHECK(list.head == NULL && zerolist_size(&list) == 0);
+            CHECK(more == (pending > 0));
+            CHECK(reclaim_count(&list) == pending);
+            check_free_slots();
+            if (calls > POOL_NODES * 4) break;
+        }
+        CHECK(list.reclaim == NULL);
+        CHECK(!zerolist_clear_step(&list, (ZEROLIST_TYPE)budget));
+
+#if ZEROLIST_BLOOM_ENABLE
+        // 4. 回收完毕后布隆计数全部归零
+        for (int i = 0; i < POOL_NODES; i++) {
+            CHECK(!zerolist_may_contain(&list, &values[i]));
+        }
+#endif
+    }
+
+    // 5. 分步销毁：中途留下待回收节点也能完整收尾
+    fill(POOL_NODES / 2);
+    CHECK(zerolist_clear_step(&list, 0));
+    fill(4);
+    while (zerolist_destroy_step(&list, 3)) {
+    }
+    CHECK(list.head == NULL && list.reclaim == NULL);
+
+    printf("clear_step: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file clone.c
+ * @brief 结构化克隆检查：zerolist_clone
+ *
+ * 对经过随机插入、删除、反转的链表克隆，确认副本内容与顺序相同、之后两者各自修改互不影响，
+ * 副本的空闲节点也能继续使用；开启键指纹与成员索引时确认副本按自己的节点重建。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：clone
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 40
+#define ROUNDS     300
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[POOL_NODES];
+static void*    snapshot[POOL_NODES];
+static unsigned seed = 71u;
+static int      errors;
+
+ZEROLIST_DEFINE(src, POOL_NODES);
+ZEROLIST_DEFINE(dst, POOL_NODES);
+ZEROLIST_DEFINE(tiny, POOL_NODES / 4);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+#if ZEROLIST_KEY_ENABLE
+static ZEROLIST_KEY_TYPE key_of(const void* data)
+{
+    return (ZEROLIST_KEY_TYPE)((const int*)data - values);
+}
+#endif
+
+static int take(Zerolist* list, void** out)
+{
+    int n = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        out[n++] = node->data;
+    }
+    return n;
+}
+
+// list 的内容依次等于 expect[0..n)，且每个节点都能通过各项附加功能找到
+static void check_same(Zerolist* list, void* const* expect, int n)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        CHECK(i < n && node->data == expect[i]);
+#if ZEROLIST_KEY_ENABLE
+        CHECK(zerolist_search_key(list, key_of(node->data), node->data, NULL) != NULL);
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+        CHECK(zerolist_contains(list, node->data));
+#endif
+        i++;
+    }
+    CHECK(i == n && (int)zerolist_size(list) == n);
+}
+
+static void mutate(Zerolist* list, int steps)
+{
+    for (int k = 0; k < steps; k++) {
+        int size = (int)zerolist_size(list);
+        int op   = next_rand(6);
+        if (op < 3 && size < POOL_NODES) {
+            // 成员索引要求数据唯一：只插入尚未在链表中的数据
+            void* data = &values[next_rand(POOL_NODES)];
+            if (!zerolist_find(list, data)) zerolist_push_back(list, data);
+        } else if (op == 3 && size) {
+            zerolist_remove_at(list, (ZEROLIST_TYPE)next_rand(size));
+        } else if (op == 4 && size) {
+            zerolist_pop_front(list);
+        } else if (next_rand(4) == 0) {
+            zerolist_reverse(list);
+        }
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(src);
+    ZEROLIST_INIT(dst);
+    ZEROLIST_INIT(tiny);
+#if ZEROLIST_KEY_ENABLE
+    zerolist_set_key_func(&src, key_of);
+    zerolist_set_key_func(&dst, key_of);
+#endif
+
+    for (int r = 0; r < ROUNDS && !errors; r++) {
+        mutate(&src, 20);
+
+        // 1. 副本与源内容相同
+        int n = take(&src, snapshot);
+        CHECK(zerolist_clone(&dst, &src));
+        check_same(&dst, snapshot, n);
+
+        // 2. 之后修改副本不影响源，副本的空闲节点可以继续分配
+        mutate(&dst, 20);
+        check_same(&src, snapshot, n);
+        while ((int)zerolist_size(&dst) < POOL_NODES
+               && zerolist_size(&dst) < zerolist_size(&src) + 4) {
+            CHECK(zerolist_push_front(&dst, &values[next_rand(POOL_NODES)]));
+        }
+
+        // 3. 修改源不影响之前的副本
+        CHECK(zerolist_clone(&dst, &src));
+        mutate(&src, 20);
+        check_same(&dst, snapshot, n);
+    }
+
+    // 4. 空链表克隆得到空链表
+    zerolist_clear(&src);
+    CHECK(zerolist_clone(&dst, &src));
+    CHECK(dst.head == NULL && zerolist_size(&dst) == 0);
+    CHECK(!zerolist_clone(&dst, NULL));
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 5. 纯静态模式下目标容量不足时失败
+    CHECK(zerolist_push_back(&src, &values[0]));
+    CHECK(!zerolist_clone(&tiny, &src));
+#endif
+
+    zerolist_destroy(&src);
+    zerolist_destroy(&dst);
+    zerolist_destroy(&tiny);
+    printf("clone: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
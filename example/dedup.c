@@ -0,0 +1,172 @@
+/**
+ * @file dedup.c
+ * @brief 去重与划分检查：zerolist_unique / zerolist_partition
+ *
+ * 按指针和按自定义相等去重，确认保留每组最先出现的节点且顺序不变；
+ * 划分后确认两条链表都保持原顺序；纯静态模式下还确认 out 节点池耗尽时返回失败、
+ * 已移动与未移动的数据都不丢失。任何不一致都以非零退出码结束。
+ *
+ * 用法：dedup
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define ITEM_COUNT 300
+#define POOL_NODES (ITEM_COUNT * 2)
+#define SMALL_POOL 8
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+typedef struct
+{
+    int key;  // 相等判断只看 key
+    int seq;  // 原始位置
+} Item;
+
+static Item     items[ITEM_COUNT];
+static unsigned seed = 99u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+ZEROLIST_DEFINE(out, POOL_NODES);
+ZEROLIST_DEFINE(small, SMALL_POOL);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static int count_nodes(Zerolist* l)
+{
+    int n = 0;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        (void)node;
+        n++;
+    }
+    return n;
+}
+
+static uint32_t hash_key(const void* data)
+{
+    return (uint32_t)((const Item*)data)->key * 2654435761u;
+}
+
+static bool same_key(const void* a, const void* b)
+{
+    return ((const Item*)a)->key == ((const Item*)b)->key;
+}
+
+static bool is_odd(const void* data, void* ctx)
+{
+    (void)ctx;
+    return ((const Item*)data)->seq & 1;
+}
+
+// seq 严格递增（即保持原顺序），且满足 pred 的与 want 一致
+static void check_ordered(Zerolist* l, int want_odd)
+{
+    int prev = -1;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        const Item* it = (const Item*)node->data;
+        CHECK(it->seq > prev);
+        if (want_odd >= 0) CHECK((it->seq & 1) == want_odd);
+        prev = it->seq;
+    }
+}
+
+static void fill(Zerolist* l)
+{
+    zerolist_clear(l);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        zerolist_push_back(l, &items[i]);
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+    ZEROLIST_INIT(out);
+    ZEROLIST_INIT(small);
+
+    // 键取值范围小，制造大量相等元素
+    int distinct = 0;
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        items[i].key = next_rand(50);
+        items[i].seq = i;
+    }
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        int first = 1;
+        for (int j = 0; j < i && first; j++) {
+            if (items[j].key == items[i].key) first = 0;
+        }
+        distinct += first;
+    }
+
+    // 1. 按指针去重：每个对象入队两次
+    fill(&list);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        zerolist_push_back(&list, &items[i]);
+    }
+    CHECK(zerolist_unique(&list, NULL, NULL) == ITEM_COUNT);
+    CHECK(count_nodes(&list) == ITEM_COUNT);
+    check_ordered(&list, -1);
+
+    // 2. 按键去重：保留每个键最先出现的节点
+    CHECK(zerolist_unique(&list, hash_key, same_key) == (size_t)(ITEM_COUNT - distinct));
+    CHECK(count_nodes(&list) == distinct);
+    check_ordered(&list, -1);
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        const Item* it = (const Item*)node->data;
+        for (int j = 0; j < it->seq; j++) {
+            CHECK(items[j].key != it->key);
+        }
+    }
+    CHECK(zerolist_unique(&list, hash_key, same_key) == 0);
+
+    // 3. 划分：奇数位置移到 out，两边保持原顺序
+    size_t moved = 0;
+    fill(&list);
+    zerolist_clear(&out);
+    CHECK(zerolist_partition(&list, is_odd, NULL, &out, &moved));
+    CHECK(moved == ITEM_COUNT / 2);
+    CHECK(count_nodes(&out) == ITEM_COUNT / 2);
+    CHECK(count_nodes(&list) == ITEM_COUNT - ITEM_COUNT / 2);
+    check_ordered(&out, 1);
+    check_ordered(&list, 0);
+
+    // 4. 非法参数与空链表
+    CHECK(!zerolist_partition(&list, is_odd, NULL, &list, &moved) && moved == 0);
+    CHECK(!zerolist_partition(&list, NULL, NULL, &out, NULL));
+    zerolist_clear(&list);
+    CHECK(zerolist_partition(&list, is_odd, NULL, &out, &moved) && moved == 0);
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 5. out 节点池耗尽：返回失败，已移动的在 out 中，其余仍在 list 中
+    fill(&list);
+    CHECK(!zerolist_partition(&list, is_odd, NULL, &small, &moved));
+    CHECK(moved == SMALL_POOL);
+    CHECK(count_nodes(&small) == SMALL_POOL);
+    CHECK(count_nodes(&list) == ITEM_COUNT - SMALL_POOL);
+    check_ordered(&small, 1);
+    check_ordered(&list, -1);
+#endif
+
+    zerolist_destroy(&list);
+    zerolist_destroy(&out);
+    zerolist_destroy(&small);
+    printf("dedup: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
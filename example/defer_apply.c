@@ -0,0 +1,142 @@
+/**
+ * @file defer_apply.c
+ * @brief 延迟修改日志示例：zerolist_defer 记录、zerolist_apply_pending 批量应用
+ *
+ * 链表以 2 个节点的容量初始化，批次中的 PUSH 会触发缓冲区扩容（realloc 搬迁），
+ * 同一批次里的删除/移动目标必须随之重定位。示例把每批的结果与按记录顺序逐条执行的
+ * 参考模型逐项比较，任何不一致都以非零退出码结束。
+ *
+ * 用法：defer_apply [rounds]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../zerolist.h"
+
+#define INITIAL_NODES  2
+#define VALUE_KINDS    4
+#define MODEL_CAPACITY 64
+#define RESTART_ROUNDS 50
+#define DEFAULT_ROUNDS 2000
+
+// 数据直接编码为指针：取值 + 1（保证非 NULL）
+#define VALUE_MAKE(v) ((void*)(uintptr_t)((v) + 1))
+
+// 参考模型：按顺序保存链表中的数据指针
+static void*  model[MODEL_CAPACITY];
+static size_t model_len;
+
+static size_t model_find(void* data)
+{
+    for (size_t i = 0; i < model_len; i++) {
+        if (model[i] == data) return i;
+    }
+    return model_len;
+}
+
+static void model_apply(zerolist_defer_op_t op, void* data)
+{
+    size_t pos;
+    switch (op) {
+    case ZEROLIST_DEFER_PUSH_BACK:
+        model[model_len++] = data;
+        return;
+    case ZEROLIST_DEFER_PUSH_FRONT:
+        for (size_t i = model_len; i > 0; i--) model[i] = model[i - 1];
+        model[0] = data;
+        model_len++;
+        return;
+    default:
+        break;
+    }
+
+    pos = model_find(data);
+    if (pos == model_len) return;
+    for (size_t i = pos; i + 1 < model_len; i++) model[i] = model[i + 1];
+    model_len--;
+    if (op == ZEROLIST_DEFER_MOVE_FRONT) {
+        model_apply(ZEROLIST_DEFER_PUSH_FRONT, data);
+    } else if (op == ZEROLIST_DEFER_MOVE_BACK) {
+        model_apply(ZEROLIST_DEFER_PUSH_BACK, data);
+    }
+}
+
+static int check(Zerolist* list, const char* what)
+{
+    size_t i = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        if (i >= model_len || node->data != model[i]) break;
+        i++;
+    }
+    if (i == model_len && (size_t)zerolist_size(list) == model_len) return 0;
+
+    printf("  %s: mismatch at position %lu (list %d nodes, expected %lu)\n", what,
+           (unsigned long)i, (int)zerolist_size(list), (unsigned long)model_len);
+    return 1;
+}
+
+static bool defer_both(Zerolist* list, zerolist_defer_op_t op, void* data)
+{
+    if (!zerolist_defer(list, op, data)) return false;
+    model_apply(op, data);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    int      rounds = argc > 1 ? atoi(argv[1]) : DEFAULT_ROUNDS;
+    unsigned seed   = 12345u;
+    int      errors = 0;
+    Zerolist list   = { 0 };
+
+#if ZEROLIST_USE_MALLOC
+    if (!list_init_dynamic(&list)) return 1;
+#elif ZEROLIST_STATIC_DYNAMIC_EXPAND
+    if (!list_init_dynamic_expand(&list, INITIAL_NODES)) return 1;
+#else
+#error "defer_apply needs a growable list (malloc or dynamic expand mode)"
+#endif
+
+    // 固定场景：两个 PUSH 让缓冲区扩容后，再删除/移动扩容前已存在的节点
+    zerolist_push_back(&list, VALUE_MAKE(0));
+    zerolist_push_back(&list, VALUE_MAKE(1));
+    model_apply(ZEROLIST_DEFER_PUSH_BACK, VALUE_MAKE(0));
+    model_apply(ZEROLIST_DEFER_PUSH_BACK, VALUE_MAKE(1));
+    defer_both(&list, ZEROLIST_DEFER_PUSH_BACK, VALUE_MAKE(2));
+    defer_both(&list, ZEROLIST_DEFER_PUSH_BACK, VALUE_MAKE(0));
+    defer_both(&list, ZEROLIST_DEFER_REMOVE, VALUE_MAKE(1));
+    defer_both(&list, ZEROLIST_DEFER_MOVE_BACK, VALUE_MAKE(0));
+    // 同一数据的移动与删除：删除作用于移动之后的第一个节点
+    defer_both(&list, ZEROLIST_DEFER_REMOVE, VALUE_MAKE(0));
+    zerolist_apply_pending(&list);
+    errors += check(&list, "expand during apply");
+
+    // 随机批次：少量取值制造重复数据；定期重建链表，让 PUSH 反复从小容量开始扩容
+    for (int r = 0; r < rounds && !errors; r++) {
+        if (r % RESTART_ROUNDS == 0) {
+            zerolist_destroy(&list);
+            if (!zerolist_reinit(&list, INITIAL_NODES)) return 1;
+            model_len = 0;
+        }
+        int batch = (int)(seed % ZEROLIST_DEFER_SLOTS) + 1;
+        for (int k = 0; k < batch; k++) {
+            seed                   = seed * 1103515245u + 12345u;
+            zerolist_defer_op_t op = (zerolist_defer_op_t)((seed >> 16) % 5);
+            void*               v  = VALUE_MAKE((seed >> 8) % VALUE_KINDS);
+            if (model_len + 1 >= MODEL_CAPACITY && op <= ZEROLIST_DEFER_PUSH_FRONT) {
+                op = ZEROLIST_DEFER_REMOVE;
+            }
+            defer_both(&list, op, v);
+        }
+        zerolist_apply_pending(&list);
+        errors += check(&list, "random batch");
+    }
+
+    printf("deferred apply: %d rounds, %d nodes, %s\n", rounds, (int)zerolist_size(&list),
+           errors ? "FAILED" : "ok");
+    zerolist_destroy(&list);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file delta.c
+ * @brief 增量检查点检查：zerolist_checkpoint_delta / zerolist_apply_delta
+ *
+ * 主链表执行随机插入、删除、反转，每轮把脏槽位记录应用到副本，确认副本的元素顺序
+ * 与空闲栈都与主链表一致；奇数轮在应用前继续修改主链表，确认记录按值保存、
+ * 不引用主链表的内存。任何不一致都以非零退出码结束。
+ *
+ * 用法：delta
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES  64
+#define VALUE_COUNT 256
+#define ROUNDS      300
+#define MAX_RECORDS (POOL_NODES * 4)
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+typedef struct
+{
+    zerolist_delta_rec_t rec[MAX_RECORDS];
+    size_t               count;
+} Batch;
+
+// 主链表在某一时刻的内容：元素顺序与空闲栈
+typedef struct
+{
+    void*         data[POOL_NODES];
+    int           size;
+    ZEROLIST_TYPE free_stack[POOL_NODES];
+    int           free_top;
+} Snapshot;
+
+static int      values[VALUE_COUNT];
+static Batch    batch;
+static unsigned seed = 7u;
+static int      errors;
+
+ZEROLIST_DEFINE(primary, POOL_NODES);
+ZEROLIST_DEFINE(replica, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static void collect(void* ctx, const zerolist_delta_rec_t* rec)
+{
+    Batch* b = (Batch*)ctx;
+    if (b->count < MAX_RECORDS) b->rec[b->count] = *rec;
+    b->count++;
+}
+
+static void take(Zerolist* list, Snapshot* snap)
+{
+    snap->size = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        snap->data[snap->size++] = node->data;
+    }
+#if ZEROLIST_FAST_ALLOC
+    snap->free_top = list->free_top;
+    for (int i = 0; i < snap->free_top; i++) {
+        snap->free_stack[i] = list->free_stack[i];
+    }
+#else
+    snap->free_top = 0;
+#endif
+}
+
+static int same(const Snapshot* a, const Snapshot* b)
+{
+    if (a->size != b->size || a->free_top != b->free_top) return 0;
+    for (int i = 0; i < a->size; i++) {
+        if (a->data[i] != b->data[i]) return 0;
+    }
+    for (int i = 0; i < a->free_top; i++) {
+        if (a->free_stack[i] != b->free_stack[i]) return 0;
+    }
+    return 1;
+}
+
+static void mutate(int steps)
+{
+    for (int k = 0; k < steps; k++) {
+        int size = (int)zerolist_size(&primary);
+        int op   = next_rand(5);
+        if (op < 3 && size >= POOL_NODES) op = 3;  // 动态扩容模式下也保持在快照容量内
+        if (op < 2) {
+            zerolist_push_back(&primary, &values[next_rand(VALUE_COUNT)]);
+        } else if (op == 2) {
+            zerolist_push_front(&primary, &values[next_rand(VALUE_COUNT)]);
+        } else if (op == 3 && size) {
+            zerolist_remove_at(&primary, (ZEROLIST_TYPE)next_rand(size));
+        } else if (size) {
+            zerolist_pop_front(&primary);
+        }
+        if (next_rand(100) == 0) zerolist_reverse(&primary);
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(primary);
+    ZEROLIST_INIT(replica);
+
+    Snapshot expected, actual;
+    size_t   total = 0;
+    for (int round = 0; round < ROUNDS && !errors; round++) {
+        mutate(10);
+
+        zerolist_delta_hdr_t hdr;
+        batch.count = 0;
+        size_t n    = zerolist_checkpoint_delta(&primary, collect, &batch, &hdr);
+        CHECK(n == batch.count && n <= MAX_RECORDS);
+        total += n;
+        take(&primary, &expected);
+
+        // 奇数轮：应用前继续修改主链表，副本只能依赖记录中的值
+        if (round & 1) mutate(5);
+
+        CHECK(zerolist_apply_delta(&replica, &hdr, batch.rec, batch.count));
+        take(&replica, &actual);
+        CHECK(same(&expected, &actual));
+
+        // 没有修改时检查点为空（空闲栈区间除外）
+        if (!(round & 1)) {
+            batch.count = 0;
+            zerolist_checkpoint_delta(&primary, collect, &batch, &hdr);
+            for (size_t i = 0; i < batch.count; i++) {
+                CHECK(batch.rec[i].kind == ZEROLIST_DELTA_FREE);
+            }
+        }
+    }
+
+    printf("delta checkpoint: %d rounds, %.1f records/round, %s\n", ROUNDS,
+           (double)total / ROUNDS, errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
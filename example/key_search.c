@@ -0,0 +1,128 @@
+/**
+ * @file key_search.c
+ * @brief 节点内联键指纹检查：zerolist_search_key 与区间提取后的键重算
+ *
+ * 两条链表使用不同的键提取函数，节点经 zerolist_extract_range / zerolist_extract_nodes
+ * 移入另一条链表后，必须能用目标链表的键找到。任何不一致都以非零退出码结束。
+ *
+ * 用法：key_search
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define ITEM_COUNT 12
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+typedef struct
+{
+    uint32_t id;
+} Item;
+
+static Item items[ITEM_COUNT];
+static int  errors;
+
+ZEROLIST_DEFINE(src, 32);
+ZEROLIST_DEFINE(dst, 32);
+
+static ZEROLIST_KEY_TYPE key_by_id(const void* data)
+{
+    return (ZEROLIST_KEY_TYPE)((const Item*)data)->id;
+}
+
+static ZEROLIST_KEY_TYPE key_scrambled(const void* data)
+{
+    return (ZEROLIST_KEY_TYPE)(((const Item*)data)->id * 2654435761u + 1u);
+}
+
+// 故意制造指纹冲突，命中必须由比较函数确认
+static ZEROLIST_KEY_TYPE key_coarse(const void* data)
+{
+    return (ZEROLIST_KEY_TYPE)(((const Item*)data)->id & 3u);
+}
+
+static bool same_id(const void* a, const void* b)
+{
+    return ((const Item*)a)->id == ((const Item*)b)->id;
+}
+
+// dst 中每个节点都必须能按 dst 的键找回自身
+static void check_all_found(Zerolist* list, ZEROLIST_KEY_TYPE (*key)(const void*))
+{
+    int count = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        CHECK(zerolist_search_key(list, key(node->data), node->data, NULL) == node);
+        CHECK(zerolist_search_key(list, key(node->data), node->data, same_id) == node);
+        count++;
+    }
+    CHECK(count == (int)zerolist_size(list));
+}
+
+static void reset(void)
+{
+    zerolist_destroy(&src);
+    zerolist_destroy(&dst);
+    zerolist_reinit(&src, 32);
+    zerolist_reinit(&dst, 32);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        zerolist_push_back(&src, &items[i]);
+    }
+}
+
+int main(void)
+{
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        items[i].id = (uint32_t)(100 + i);
+    }
+    ZEROLIST_INIT(src);
+    ZEROLIST_INIT(dst);
+
+    // 1. 按下标区间提取：节点换用 dst 的键
+    reset();
+    zerolist_set_key_func(&src, key_by_id);
+    zerolist_set_key_func(&dst, key_scrambled);
+    CHECK(zerolist_extract_range(&src, 2, 6, &dst) == 4);
+    CHECK(zerolist_size(&dst) == 4);
+    check_all_found(&dst, key_scrambled);
+    check_all_found(&src, key_by_id);
+
+    // 2. 按节点区间提取，目标链表非空时追加在尾部
+    zerolist_node_t* first = zerolist_find(&src, &items[7]);
+    zerolist_node_t* last  = zerolist_find(&src, &items[9]);
+    CHECK(first && last);
+    CHECK(zerolist_extract_nodes(&src, first, last, &dst) == 3);
+    CHECK(zerolist_size(&dst) == 7);
+    check_all_found(&dst, key_scrambled);
+
+    // 3. 指纹冲突：NULL 比较函数取第一个键相等的节点，比较函数区分冲突
+    reset();
+    zerolist_set_key_func(&src, key_coarse);
+    zerolist_node_t* hit = zerolist_search_key(&src, key_coarse(&items[5]), &items[5], same_id);
+    CHECK(hit && hit->data == &items[5]);
+    hit = zerolist_search_key(&src, key_coarse(&items[5]), &items[5], NULL);
+    CHECK(hit && key_coarse(hit->data) == key_coarse(&items[5]));
+
+    // 4. 未设置键提取函数：有比较函数按比较函数查找，否则按数据指针查找
+    zerolist_set_key_func(&src, NULL);
+    Item probe = { items[3].id };
+    hit        = zerolist_search_key(&src, 0, &probe, same_id);
+    CHECK(hit && hit->data == &items[3]);
+    hit = zerolist_search_key(&src, 0, &items[4], NULL);
+    CHECK(hit && hit->data == &items[4]);
+    CHECK(zerolist_search_key(&src, 0, &probe, NULL) == NULL);
+
+    zerolist_destroy(&src);
+    zerolist_destroy(&dst);
+    printf("key search: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file membership.c
+ * @brief 成员判断检查：计数布隆过滤器与去重合并队列的成员索引
+ *
+ * 依次插入、合并、删除一批对象，确认过滤器没有假阴性、假阳性率有界，
+ * 成员索引与链表内容一致；动态模式下还确认两者随元素数扩容（不依赖 ZEROLIST_SIZE_ENABLE）。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：membership
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#if ZEROLIST_USE_MALLOC
+#define ITEM_COUNT 4000
+#else
+#define ITEM_COUNT 200
+#endif
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int items[ITEM_COUNT];
+static int absent[ITEM_COUNT];
+static int errors;
+
+ZEROLIST_DEFINE(list, ITEM_COUNT);
+
+// 不依赖 ZEROLIST_SIZE_ENABLE 的长度
+static int count_nodes(Zerolist* l)
+{
+    int n = 0;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        (void)node;
+        n++;
+    }
+    return n;
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+
+    // 1. 去重入队：重复投递不增加节点
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < ITEM_COUNT; i++) {
+            CHECK(zerolist_push_back_unique(&list, &items[i], false));
+        }
+    }
+    CHECK(count_nodes(&list) == ITEM_COUNT);
+    CHECK(list.head->data == &items[0]);
+
+    // 2. move_to_back：已在队列中的对象移到队尾
+    CHECK(zerolist_push_back_unique(&list, &items[0], true));
+    CHECK(ZEROLIST_NODE_PREV(&list, list.head)->data == &items[0]);
+    CHECK(list.head->data == &items[1]);
+    CHECK(count_nodes(&list) == ITEM_COUNT);
+
+#if ZEROLIST_USE_MALLOC
+    // 动态模式：索引桶数与过滤器容量跟随元素数增长
+    CHECK(list.index_slots >= ITEM_COUNT);
+    CHECK(list.bloom_slots >= (size_t)ITEM_COUNT * ZEROLIST_BLOOM_RATIO);
+#endif
+
+    // 3. 成员判断：在链表中的必定命中，不在的由过滤器大多直接否定
+    int false_positive = 0;
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        CHECK(zerolist_may_contain(&list, &items[i]));
+        CHECK(zerolist_contains(&list, &items[i]));
+        CHECK(!zerolist_contains(&list, &absent[i]));
+        false_positive += zerolist_may_contain(&list, &absent[i]);
+    }
+    CHECK(false_positive * 10 < ITEM_COUNT);
+
+    // 4. 删除偶数下标：索引与过滤器同步
+    for (int i = 0; i < ITEM_COUNT; i += 2) {
+        CHECK(zerolist_remove_ptr(&list, &items[i]));
+    }
+    CHECK(count_nodes(&list) == ITEM_COUNT / 2);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        CHECK(zerolist_contains(&list, &items[i]) == (i % 2 == 1));
+        if (i % 2 == 1) CHECK(zerolist_may_contain(&list, &items[i]));
+        CHECK((zerolist_find(&list, &items[i]) != NULL) == (i % 2 == 1));
+    }
+
+    // 5. 清空后重新入队
+    zerolist_clear(&list);
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        CHECK(!zerolist_contains(&list, &items[i]));
+    }
+    for (int i = ITEM_COUNT - 1; i >= 0; i--) {
+        CHECK(zerolist_push_back_unique(&list, &items[i], true));
+    }
+    CHECK(count_nodes(&list) == ITEM_COUNT);
+    CHECK(list.head->data == &items[ITEM_COUNT - 1]);
+
+    zerolist_destroy(&list);
+    printf("membership: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+/**
+ * @file merge.c
+ * @brief 有序合并检查：zerolist_merge 与 zerolist_merge_k
+ *
+ * 随机生成若干条有序链表，合并后确认结果有序、相等元素保持输入顺序（稳定）、
+ * 元素不丢不重；并确认非法参数（out 出现在 lists 中、同一链表出现两次）被拒绝。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：merge
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define LIST_COUNT 5
+#define PER_LIST   40
+#define POOL_NODES (LIST_COUNT * PER_LIST)
+#define ROUNDS     50
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+typedef struct
+{
+    int key;  // 排序键
+    int seq;  // 全局输入次序：先按链表下标，再按链表内位置
+} Item;
+
+static Item     items[POOL_NODES];
+static unsigned seed = 2024u;
+static int      errors;
+
+ZEROLIST_DEFINE(out, POOL_NODES);
+ZEROLIST_DEFINE(in0, POOL_NODES);
+ZEROLIST_DEFINE(in1, POOL_NODES);
+ZEROLIST_DEFINE(in2, POOL_NODES);
+ZEROLIST_DEFINE(in3, POOL_NODES);
+ZEROLIST_DEFINE(in4, POOL_NODES);
+
+static Zerolist* inputs[LIST_COUNT] = { &in0, &in1, &in2, &in3, &in4 };
+
+static int by_key(const void* a, const void* b)
+{
+    return ((const Item*)a)->key - ((const Item*)b)->key;
+}
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static int count_nodes(Zerolist* l)
+{
+    int n = 0;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        (void)node;
+        n++;
+    }
+    return n;
+}
+
+// 每条输入链表的键单调不减，取值范围小以制造大量相等元素
+static void fill_inputs(int lists)
+{
+    int used = 0;
+    for (int l = 0; l < LIST_COUNT; l++) {
+        zerolist_clear(inputs[l]);
+        if (l >= lists) continue;
+        int key = 0;
+        int len = next_rand(PER_LIST + 1);
+        for (int i = 0; i < len; i++) {
+            key += next_rand(3);
+            items[used].key = key;
+            items[used].seq = used;
+            zerolist_push_back(inputs[l], &items[used++]);
+        }
+    }
+}
+
+// 结果有序且稳定，并覆盖全部 expected 个元素
+static void check_sorted(Zerolist* l, int expected)
+{
+    const Item* prev = NULL;
+    ZEROLIST_FOR_EACH(l, node)
+    {
+        const Item* cur = (const Item*)node->data;
+        if (prev) {
+            CHECK(prev->key <= cur->key);
+            if (prev->key == cur->key) CHECK(prev->seq < cur->seq);
+        }
+        prev = cur;
+    }
+    CHECK(count_nodes(l) == expected);
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(out);
+    ZEROLIST_INIT(in0);
+    ZEROLIST_INIT(in1);
+    ZEROLIST_INIT(in2);
+    ZEROLIST_INIT(in3);
+    ZEROLIST_INIT(in4);
+
+    for (int r = 0; r < ROUNDS && !errors; r++) {
+        // 1. 两路合并：结果留在第一条链表，第二条被取空
+        fill_inputs(2);
+        int total = count_nodes(&in0) + count_nodes(&in1);
+        CHECK(zerolist_merge(&in0, &in1, by_key));
+        CHECK(in1.head == NULL);
+        check_sorted(&in0, total);
+
+        // 2. k 路合并，其中夹一个 NULL
+        fill_inputs(LIST_COUNT);
+        Zerolist* lists[LIST_COUNT + 1] = { &in0, &in1, NULL, &in2, &in3, &in4 };
+        total                           = 0;
+        for (int l = 0; l < LIST_COUNT; l++) {
+            total += count_nodes(inputs[l]);
+        }
+        zerolist_clear(&out);
+        CHECK(zerolist_merge_k(&out, lists, LIST_COUNT + 1, by_key));
+        for (int l = 0; l < LIST_COUNT; l++) {
+            CHECK(inputs[l]->head == NULL);
+        }
+        check_sorted(&out, total);
+    }
+
+    // 3. 非法参数：不修改任何链表
+    fill_inputs(2);
+    int       before0 = count_nodes(&in0);
+    Zerolist* dup[3]  = { &in0, &in1, &in0 };
+    Zerolist* self[2] = { &in0, &out };
+    zerolist_clear(&out);
+    CHECK(!zerolist_merge_k(&out, dup, 3, by_key));
+    CHECK(!zerolist_merge_k(&out, self, 2, by_key));
+    CHECK(count_nodes(&in0) == before0);
+    CHECK(out.head == NULL);
+
+    zerolist_destroy(&out);
+    for (int l = 0; l < LIST_COUNT; l++) {
+        zerolist_destroy(inputs[l]);
+    }
+    printf("merge: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
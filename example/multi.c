@@ -0,0 +1,125 @@
+/**
+ * @file multi.c
+ * @brief 多链表成员节点检查：zerolist_mpool_* / zerolist_mlist_*
+ *
+ * 同一节点同时挂在 LRU 与超时两条链表上，确认各链表顺序独立、释放时从所有链表摘除；
+ * 并确认另一个节点池的节点被各操作拒绝，不会破坏本池链表。动态模式下还覆盖缓冲区
+ * 耗尽后的 malloc 回退节点。任何不一致都以非零退出码结束。
+ *
+ * 用法：multi
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 16
+#define SLOT_LRU   0
+#define SLOT_TIMER 1
+
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC
+#define ITEM_COUNT (POOL_NODES * 2)
+#else
+#define ITEM_COUNT POOL_NODES
+#endif
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int               values[ITEM_COUNT];
+static zerolist_mnode_t* nodes[ITEM_COUNT];
+static int               errors;
+
+ZEROLIST_MPOOL_DEFINE(pool, POOL_NODES);
+ZEROLIST_MPOOL_DEFINE(other, 4);
+
+static zerolist_mlist_t lru, timer, other_lru;
+
+// 链表前 count 个节点依次为 values[first], values[first + step], ...，长度为 size
+static void check_order(zerolist_mlist_t* list, int first, int step, int count, int size)
+{
+    int i = 0;
+    ZEROLIST_MLIST_FOR_EACH(list, node)
+    {
+        if (i < count) CHECK(node->data == &values[first + i * step]);
+        i++;
+    }
+    CHECK(i == size && list->size == (ZEROLIST_TYPE)size);
+}
+
+int main(void)
+{
+    ZEROLIST_MPOOL_INIT(pool);
+    ZEROLIST_MPOOL_INIT(other);
+    CHECK(zerolist_mlist_init(&lru, &pool, SLOT_LRU));
+    CHECK(zerolist_mlist_init(&timer, &pool, SLOT_TIMER));
+    CHECK(!zerolist_mlist_init(&other_lru, &pool, SLOT_LRU));
+    CHECK(zerolist_mlist_init(&other_lru, &other, SLOT_LRU));
+
+    // 1. 分配并挂到两条链表：LRU 按分配顺序，超时链表逆序
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        nodes[i] = zerolist_mnode_alloc(&pool, &values[i]);
+        CHECK(nodes[i] != NULL);
+        CHECK(zerolist_mlist_push_back(&lru, nodes[i]));
+        CHECK(zerolist_mlist_push_front(&timer, nodes[i]));
+        CHECK(!zerolist_mlist_push_back(&lru, nodes[i]));
+    }
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC
+    CHECK(zerolist_mnode_alloc(&pool, NULL) == NULL);
+#endif
+    check_order(&lru, 0, 1, ITEM_COUNT, ITEM_COUNT);
+    check_order(&timer, ITEM_COUNT - 1, -1, ITEM_COUNT, ITEM_COUNT);
+
+    // 2. LRU 访问：头节点移到尾部，超时链表不受影响
+    CHECK(zerolist_mlist_move_to_back(&lru, nodes[0]));
+    CHECK(lru.head == nodes[1]);
+    CHECK(lru.head->link[SLOT_LRU].prev == nodes[0]);
+    CHECK(zerolist_mlist_move_to_back(&lru, nodes[0]));
+    CHECK(timer.head == nodes[ITEM_COUNT - 1]);
+
+    // 3. 只从一条链表摘除，节点仍在另一条中
+    CHECK(zerolist_mlist_remove(&timer, nodes[1]));
+    CHECK(!zerolist_mnode_in(&timer, nodes[1]));
+    CHECK(zerolist_mnode_in(&lru, nodes[1]));
+    CHECK(!zerolist_mlist_remove(&timer, nodes[1]));
+
+    // 4. 其他节点池的节点：与本池链表同槽位的成员位不能让它混进来
+    zerolist_mnode_t* foreign = zerolist_mnode_alloc(&other, &values[0]);
+    CHECK(foreign && zerolist_mlist_push_back(&other_lru, foreign));
+    CHECK(!zerolist_mnode_in(&lru, foreign));
+    CHECK(!zerolist_mlist_remove(&lru, foreign));
+    CHECK(!zerolist_mlist_move_to_back(&lru, foreign));
+    CHECK(!zerolist_mlist_push_back(&timer, foreign));
+    CHECK(!zerolist_mlist_push_front(&timer, foreign));
+    zerolist_mnode_release(&pool, foreign);
+    CHECK(foreign->in_use && zerolist_mnode_in(&other_lru, foreign));
+    CHECK(lru.size == ITEM_COUNT && timer.size == ITEM_COUNT - 1);
+
+    // 5. 释放奇数节点：从所有链表摘除，归还后可重新分配
+    for (int i = 1; i < ITEM_COUNT; i += 2) {
+        zerolist_mnode_release(&pool, nodes[i]);
+    }
+    CHECK(pool.used == ITEM_COUNT / 2);
+    check_order(&lru, 2, 2, ITEM_COUNT / 2 - 1, ITEM_COUNT / 2);
+    CHECK(lru.head->link[SLOT_LRU].prev == nodes[0]);
+    check_order(&timer, ITEM_COUNT - 2, -2, ITEM_COUNT / 2, ITEM_COUNT / 2);
+    zerolist_mnode_t* again = zerolist_mnode_alloc(&pool, &values[1]);
+    CHECK(again != NULL && !zerolist_mnode_in(&lru, again) && !zerolist_mnode_in(&timer, again));
+
+    // 6. 弹出与清空
+    CHECK(zerolist_mlist_pop_front(&timer) == nodes[ITEM_COUNT - 2]);
+    CHECK(zerolist_mnode_in(&lru, nodes[ITEM_COUNT - 2]));
+    zerolist_mnode_release(&pool, again);
+    zerolist_mpool_clear(&pool);
+    CHECK(pool.used == 0 && lru.head == NULL && timer.head == NULL);
+    zerolist_mpool_clear(&other);
+
+    printf("multi list: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
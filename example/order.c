@@ -0,0 +1,128 @@
+/**
+ * @file order.c
+ * @brief 顺序维护标签检查：zerolist_precedes / zerolist_order_compare
+ *
+ * 反复在同一位置前插入以耗尽标签间隙、触发局部重标号，并穿插头尾插入、删除、
+ * 反转与旋转；每步之后按遍历得到的位置核对任意节点对的先后关系。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：order
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 256
+#define STEPS      20000
+#define PAIRS      16
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int              values[STEPS];  // 每次插入使用新的负载，数据指针唯一
+static zerolist_node_t* order[POOL_NODES];
+static int              used;
+static unsigned         seed = 17u;
+static int              errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static void* fresh(void)
+{
+    return &values[used++];
+}
+
+static int sign(int v)
+{
+    return (v > 0) - (v < 0);
+}
+
+// 按遍历顺序记录节点，随机抽取节点对核对先后关系
+static void check_pairs(void)
+{
+    int n = 0;
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        order[n++] = node;
+    }
+    if (n == 0) return;
+    for (int k = 0; k < PAIRS; k++) {
+        int i = next_rand(n), j = next_rand(n);
+        CHECK(zerolist_precedes(&list, order[i], order[j]) == (i < j));
+        CHECK(sign(zerolist_order_compare(&list, order[i], order[j])) == sign(i - j));
+    }
+    // 相邻节点：重标号最容易出错的地方
+    int i = next_rand(n);
+    if (i + 1 < n) CHECK(zerolist_precedes(&list, order[i], order[i + 1]));
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+
+    void* hot = NULL;  // 反复在它前面插入的节点的数据
+    for (int step = 0; step < STEPS && !errors; step++) {
+        int size = (int)zerolist_size(&list);
+        int op   = next_rand(10);
+        if (op < 6 && size >= POOL_NODES) op = 6;
+        if (!hot && size) hot = zerolist_at(&list, (ZEROLIST_TYPE)next_rand(size));
+
+        switch (op) {
+        case 0:
+        case 1:
+        case 2:
+            // 新节点总是插在 hot 与其前驱之间，标签间隙每次减半
+            if (hot) {
+                CHECK(zerolist_insert_before(&list, hot, fresh()));
+            } else {
+                zerolist_push_back(&list, fresh());
+            }
+            break;
+        case 3:
+            zerolist_push_front(&list, fresh());
+            break;
+        case 4:
+        case 5:
+            zerolist_push_back(&list, fresh());
+            break;
+        case 6:
+            if (size) {
+                ZEROLIST_TYPE index = (ZEROLIST_TYPE)next_rand(size);
+                if (zerolist_at(&list, index) == hot) hot = NULL;
+                zerolist_remove_at(&list, index);
+            }
+            break;
+        case 7:
+            // 旋转：表头数据移到队尾
+            if (size) zerolist_push_back(&list, zerolist_pop_front(&list));
+            break;
+        case 8:
+            if (next_rand(10) == 0) zerolist_reverse(&list);
+            break;
+        default:
+            if (next_rand(200) == 0) {
+                zerolist_clear(&list);
+                hot = NULL;
+            }
+            break;
+        }
+        check_pairs();
+    }
+
+    zerolist_destroy(&list);
+    printf("order labels: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file persistent.c
+ * @brief 持久化链表版本检查：zerolist_pver_* 与 zerolist_pcell_*
+ *
+ * 同时持有多个共享尾部的版本，随机头插、取尾部、复制句柄与释放，
+ * 确认每个版本的内容始终不变；全部释放后节点池应完全回收。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：persistent
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES  64
+#define MAX_HANDLES 16
+#define MAX_LEN     POOL_NODES
+#define STEPS       20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+// 调用方持有的一个版本句柄及其预期内容
+typedef struct
+{
+    zerolist_pnode_t* ver;
+    void*             data[MAX_LEN];
+    int               len;
+} Handle;
+
+static int      values[POOL_NODES];
+static Handle   handles[MAX_HANDLES];
+static int      held;
+static unsigned seed = 23u;
+static int      errors;
+
+ZEROLIST_PPOOL_DEFINE(pool, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static void check_handle(const Handle* h)
+{
+    int i = 0;
+    ZEROLIST_PVER_FOR_EACH(h->ver, node)
+    {
+        CHECK(i < h->len && node->data == h->data[i]);
+        i++;
+    }
+    CHECK(i == h->len && zerolist_pver_length(h->ver) == (ZEROLIST_TYPE)h->len);
+}
+
+static void drop(int k)
+{
+    zerolist_pver_release(&pool, handles[k].ver);
+    handles[k] = handles[--held];
+}
+
+// 池中空闲节点数：逐个头插直到耗尽，再全部释放
+static int free_nodes(void)
+{
+    zerolist_pnode_t* ver = NULL;
+    int               n   = 0;
+    for (;;) {
+        zerolist_pnode_t* next = zerolist_pver_push_front(&pool, ver, &values[0]);
+        if (!next) break;
+        zerolist_pver_release(&pool, ver);
+        ver = next;
+        n++;
+    }
+    zerolist_pver_release(&pool, ver);
+    return n;
+}
+
+int main(void)
+{
+    ZEROLIST_PPOOL_INIT(pool);
+    CHECK(free_nodes() == POOL_NODES);
+
+    // 1. 随机构造版本树：各版本内容互不影响
+    handles[held++].ver = NULL;
+    for (int step = 0; step < STEPS && !errors; step++) {
+        int     k  = next_rand(held);
+        Handle* h  = &handles[k];
+        int     op = next_rand(4);
+        if (op == 0 && held < MAX_HANDLES && h->len < MAX_LEN) {
+            void*             data = &values[next_rand(POOL_NODES)];
+            zerolist_pnode_t* ver  = zerolist_pver_push_front(&pool, h->ver, data);
+            if (ver) {
+                Handle* n  = &handles[held++];
+                n->ver     = ver;
+                n->len     = h->len + 1;
+                n->data[0] = data;
+                for (int i = 0; i < h->len; i++) {
+                    n->data[i + 1] = h->data[i];
+                }
+            }
+        } else if (op == 1 && held < MAX_HANDLES && h->len) {
+            void*   data = NULL;
+            Handle* n    = &handles[held++];
+            n->ver       = zerolist_pver_pop_front(h->ver, &data);
+            n->len       = h->len - 1;
+            CHECK(data == h->data[0]);
+            for (int i = 0; i < n->len; i++) {
+                n->data[i] = h->data[i + 1];
+            }
+        } else if (op == 2 && held < MAX_HANDLES) {
+            handles[held]     = *h;
+            handles[held].ver = zerolist_pver_retain(h->ver);
+            held++;
+        } else if (held > 1) {
+            drop(k);
+        }
+        for (int i = 0; i < held; i++) {
+            check_handle(&handles[i]);
+        }
+    }
+    while (held) {
+        drop(0);
+    }
+    CHECK(free_nodes() == POOL_NODES);
+
+    // 2. 发布单元：读者取得的版本在后续发布后仍保持不变
+    zerolist_pcell_t  cell = { NULL };
+    zerolist_pnode_t* v1   = zerolist_pver_push_front(&pool, NULL, &values[1]);
+    zerolist_pnode_t* v2   = zerolist_pver_push_front(&pool, v1, &values[2]);
+    CHECK(zerolist_pcell_acquire(&pool, &cell) == NULL);
+    zerolist_pcell_publish(&pool, &cell, v2);
+    zerolist_pnode_t* seen = zerolist_pcell_acquire(&pool, &cell);
+    CHECK(seen == v2);
+    zerolist_pcell_publish(&pool, &cell, v1);
+    zerolist_pver_release(&pool, v2);
+    zerolist_pver_release(&pool, v1);
+    CHECK(zerolist_pver_length(seen) == 2 && seen->data == &values[2]);
+    zerolist_pver_release(&pool, seen);
+    zerolist_pcell_publish(&pool, &cell, NULL);
+    CHECK(free_nodes() == POOL_NODES);
+
+    printf("persistent: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
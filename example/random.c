@@ -0,0 +1,155 @@
+/**
+ * @file random.c
+ * @brief 随机访问检查：zerolist_random / zerolist_sample
+ *
+ * 在不同装载率（含大量空槽、存在待回收节点）的链表上反复随机选取，确认结果总是链表中的
+ * 节点、各节点被选中的次数接近均匀；蓄水池抽样确认结果互不相同、都在链表中，且每个元素
+ * 被抽中的次数接近 k/n。任何不一致都以非零退出码结束。
+ *
+ * 用法：random
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 64
+#define DRAWS      64000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[POOL_NODES];
+static int      hits[POOL_NODES];
+static void*    out[POOL_NODES];
+static unsigned seed = 101u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+// xorshift32：状态经 ctx 传入
+static uint32_t xorshift(void* ctx)
+{
+    uint32_t* s = (uint32_t*)ctx;
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static int index_of(const void* data)
+{
+    return (int)((const int*)data - values);
+}
+
+static bool in_list(const void* data)
+{
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        if (node->data == data) return true;
+    }
+    return false;
+}
+
+// 每个在链表中的元素命中次数都在期望值的 6 个标准差以内，不在链表中的为 0
+static void check_uniform(double expect)
+{
+    for (int i = 0; i < POOL_NODES; i++) {
+        if (in_list(&values[i])) {
+            double diff = hits[i] - expect;
+            CHECK(diff * diff < 36.0 * expect + 1.0);
+        } else {
+            CHECK(hits[i] == 0);
+        }
+        hits[i] = 0;
+    }
+}
+
+// 保留约 keep 个节点：先装满再随机删除，使在用槽位分散在整个节点池中
+static int scatter(int keep)
+{
+    zerolist_clear(&list);
+    for (int i = 0; i < POOL_NODES; i++) {
+        CHECK(zerolist_push_back(&list, &values[i]));
+    }
+    int size = POOL_NODES;
+    while (size > keep) {
+        zerolist_remove_at(&list, (ZEROLIST_TYPE)next_rand(size));
+        size--;
+    }
+    return size;
+}
+
+int main(void)
+{
+    uint32_t state = 2463534242u;
+    ZEROLIST_INIT(list);
+
+    // 1. 空链表
+    CHECK(zerolist_random(&list, xorshift, &state) == NULL);
+    CHECK(zerolist_sample(&list, 4, out, xorshift, &state) == 0);
+
+    const int loads[] = { POOL_NODES, POOL_NODES / 2, 8, 3, 1 };
+    for (size_t l = 0; l < sizeof(loads) / sizeof(loads[0]); l++) {
+        int size = scatter(loads[l]);
+
+        // 2. 随机选取：结果在链表中且近似均匀
+        for (int d = 0; d < DRAWS; d++) {
+            zerolist_node_t* node = zerolist_random(&list, xorshift, &state);
+            CHECK(node && in_list(node->data));
+            if (node) hits[index_of(node->data)]++;
+        }
+        check_uniform((double)DRAWS / size);
+
+        // 3. 存在待回收节点时同样只选中链表中的节点
+        if (size > 2 && size + size / 2 <= POOL_NODES) {
+            zerolist_node_t* head = list.head;
+            CHECK(zerolist_clear_step(&list, 0));
+            for (int i = 0; i < size / 2; i++) {
+                CHECK(zerolist_push_back(&list, &values[i]));
+            }
+            for (int d = 0; d < DRAWS / 4; d++) {
+                zerolist_node_t* node = zerolist_random(&list, xorshift, &state);
+                CHECK(node && node != head && in_list(node->data));
+                if (node) hits[index_of(node->data)]++;
+            }
+            check_uniform((double)(DRAWS / 4) / (size / 2));
+            size = scatter(loads[l]);
+        }
+
+        // 4. 抽样：互不相同、都在链表中，每个元素被抽中的概率为 k/n
+        int k      = size > 4 ? size / 4 : size;
+        int rounds = DRAWS / (k ? k : 1);
+        for (int r = 0; r < rounds; r++) {
+            int n = (int)zerolist_sample(&list, (ZEROLIST_TYPE)k, out, xorshift, &state);
+            CHECK(n == k);
+            for (int i = 0; i < n; i++) {
+                CHECK(in_list(out[i]));
+                for (int j = 0; j < i; j++) {
+                    CHECK(out[i] != out[j]);
+                }
+                hits[index_of(out[i])]++;
+            }
+        }
+        check_uniform((double)rounds * k / size);
+
+        // 5. k 不小于链表长度时返回全部元素
+        CHECK((int)zerolist_sample(&list, POOL_NODES, out, xorshift, &state) == size);
+    }
+
+    zerolist_destroy(&list);
+    printf("random: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file range.c
+ * @brief 区间删除与提取检查：zerolist_erase_range/nodes、zerolist_extract_range/nodes
+ *
+ * 对链表随机执行按下标或按节点的区间删除与提取（含越界、反序端点与目标容量不足），
+ * 每步与参考数组比较两条链表的内容；纯静态模式下还确认释放的槽位全部回到节点池。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：range
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 48
+#define OUT_NODES  12
+#define STEPS      20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+// 参考模型：按顺序保存链表中的数据指针
+typedef struct
+{
+    void* data[POOL_NODES];
+    int   len;
+} Model;
+
+static int      values[POOL_NODES * 4];
+static Model    src_model, out_model;
+static unsigned seed = 61u;
+static int      errors;
+
+ZEROLIST_DEFINE(src, POOL_NODES);
+ZEROLIST_DEFINE(out, OUT_NODES);
+
+// 目标链表可以增长的模式下不限制提取数量
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+#define OUT_ROOM(m) POOL_NODES
+#else
+#define OUT_ROOM(m) (OUT_NODES - (m)->len)
+#endif
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static zerolist_node_t* node_at(Zerolist* list, int index)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        if (i++ == index) return node;
+    }
+    return NULL;
+}
+
+static void check_model(Zerolist* list, const Model* m)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(list, node)
+    {
+        CHECK(i < m->len && node->data == m->data[i]);
+        i++;
+    }
+    CHECK(i == m->len && (int)zerolist_size(list) == m->len);
+}
+
+// 从模型中移出 [first, last)，moved 个追加到 to（可为 NULL），其余丢弃
+static void model_take(Model* m, int first, int last, Model* to, int moved)
+{
+    if (last > m->len) last = m->len;
+    if (first >= last) return;
+    for (int i = 0; i < moved; i++) {
+        to->data[to->len++] = m->data[first + i];
+    }
+    int gone = to ? moved : last - first;
+    for (int i = first; i + gone < m->len; i++) {
+        m->data[i] = m->data[i + gone];
+    }
+    m->len -= gone;
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(src);
+    ZEROLIST_INIT(out);
+
+    for (int step = 0; step < STEPS && !errors; step++) {
+        int n     = src_model.len;
+        int first = next_rand(n + 2);
+        int last  = next_rand(n + 3);
+        int op    = next_rand(8);
+
+        // 目标链表的参考数组容量有限，提取前按需清空
+        if (out_model.len + n > POOL_NODES) {
+            zerolist_clear(&out);
+            out_model.len = 0;
+        }
+
+        if (op < 2 || n == 0) {
+            // 补充数据
+            for (int k = next_rand(8); k > 0 && src_model.len < POOL_NODES; k--) {
+                void* data = &values[next_rand(POOL_NODES * 4)];
+                CHECK(zerolist_push_back(&src, data));
+                src_model.data[src_model.len++] = data;
+            }
+        } else if (op == 2) {
+            int expect = first < last ? (last < n ? last : n) - (first < n ? first : n) : 0;
+            CHECK(zerolist_erase_range(&src, (ZEROLIST_TYPE)first, (ZEROLIST_TYPE)last) == expect);
+            model_take(&src_model, first, last, NULL, 0);
+        } else if (op == 3 && first < n) {
+            // last 为 NULL 或在 first 之前时删除到末尾
+            int              end  = last < n && last >= first ? last + 1 : n;
+            zerolist_node_t* tail = last < n ? node_at(&src, last) : NULL;
+            CHECK(zerolist_erase_nodes(&src, node_at(&src, first), tail) == end - first);
+            model_take(&src_model, first, end, NULL, 0);
+        } else if (op == 4) {
+            int span  = first < last && first < n ? (last < n ? last : n) - first : 0;
+            int room  = OUT_ROOM(&out_model);
+            int moved = span < room ? span : room;
+            CHECK(zerolist_extract_range(&src, (ZEROLIST_TYPE)first, (ZEROLIST_TYPE)last, &out)
+                  == moved);
+            model_take(&src_model, first, last, &out_model, moved);
+        } else if (op == 5 && first < n && last < n && last >= first) {
+            int room  = OUT_ROOM(&out_model);
+            int span  = last - first + 1;
+            int moved = span < room ? span : room;
+            CHECK(zerolist_extract_nodes(&src, node_at(&src, first), node_at(&src, last), &out)
+                  == moved);
+            model_take(&src_model, first, last + 1, &out_model, moved);
+        } else if (op == 6) {
+            zerolist_reverse(&src);
+            for (int i = 0; i < n / 2; i++) {
+                void* t                   = src_model.data[i];
+                src_model.data[i]         = src_model.data[n - 1 - i];
+                src_model.data[n - 1 - i] = t;
+            }
+        } else if (next_rand(4) == 0) {
+            zerolist_clear(&out);
+            out_model.len = 0;
+        }
+
+        check_model(&src, &src_model);
+        check_model(&out, &out_model);
+    }
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 释放的槽位全部回到节点池：恰好能再放入 POOL_NODES - len 个节点
+    for (int i = src_model.len; i < POOL_NODES; i++) {
+        CHECK(zerolist_push_back(&src, &values[0]));
+    }
+    CHECK(!zerolist_push_back(&src, &values[0]));
+#endif
+
+    zerolist_destroy(&src);
+    zerolist_destroy(&out);
+    printf("range: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file self_organize.c
+ * @brief 自组织查找检查：zerolist_set_search_policy / zerolist_get_search_stats
+ *
+ * 对每种调整策略随机执行 zerolist_find / zerolist_search 与插入、删除、反转，按参考模型
+ * 推算命中后的位置（移到表头 / 与前驱交换 / 按命中计数前移）与查找统计并逐步比较；
+ * 再确认访问集中在少数热点时，移到表头策略的平均探测深度收敛到热点集合的大小附近。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：self_organize
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 48
+#define STEPS      20000
+#define HOT        4
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[POOL_NODES];
+static uint32_t hits[POOL_NODES];   // 参考命中计数，按数据下标
+static int      model[POOL_NODES];  // 参考模型：按链表逻辑顺序保存数据下标
+static int      model_len;
+static unsigned seed = 107u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+static bool same_value(const void* a, const void* b)
+{
+    return *(const int*)a == *(const int*)b;
+}
+
+static int model_index(int v)
+{
+    for (int i = 0; i < model_len; i++) {
+        if (model[i] == v) return i;
+    }
+    return -1;
+}
+
+// 把模型中位置 from 的元素移到位置 to（to <= from）
+static void model_move(int from, int to)
+{
+    int v = model[from];
+    for (int i = from; i > to; i--) {
+        model[i] = model[i - 1];
+    }
+    model[to] = v;
+}
+
+static void model_promote(uint8_t policy, int i)
+{
+    int v = model[i];
+    if (policy == ZEROLIST_SEARCH_MOVE_TO_FRONT) {
+        model_move(i, 0);
+    } else if (policy == ZEROLIST_SEARCH_TRANSPOSE) {
+        if (i > 0) model_move(i, i - 1);
+    } else if (policy == ZEROLIST_SEARCH_COUNT) {
+        if (hits[v] != UINT32_MAX) hits[v]++;
+        int j = i;
+        while (j > 0 && hits[model[j - 1]] < hits[v]) {
+            j--;
+        }
+        model_move(i, j);
+    }
+}
+
+static void check_model(void)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        CHECK(i < model_len && node->data == &values[model[i]]);
+        i++;
+    }
+    CHECK(i == model_len && (int)zerolist_size(&list) == model_len);
+}
+
+static void run_policy(uint8_t policy)
+{
+    zerolist_clear(&list);
+    zerolist_set_search_policy(&list, policy);
+    zerolist_reset_search_stats(&list);
+    model_len = 0;
+    for (int i = 0; i < POOL_NODES; i++) {
+        hits[i] = 0;
+    }
+    zerolist_search_stats_t expect = { 0, 0, 0 };
+
+    for (int step = 0; step < STEPS && !errors; step++) {
+        int op = next_rand(10);
+        int v  = next_rand(POOL_NODES);
+        int at = model_index(v);
+        if (op < 2 && at < 0) {
+            CHECK(zerolist_push_back(&list, &values[v]));
+            model[model_len++] = v;
+            hits[v]            = 0;
+        } else if (op == 2 && at >= 0) {
+            CHECK(zerolist_remove_ptr(&list, &values[v]));
+            for (int i = at; i + 1 < model_len; i++) {
+                model[i] = model[i + 1];
+            }
+            model_len--;
+        } else if (op == 3) {
+            zerolist_reverse(&list);
+            for (int i = 0; i < model_len / 2; i++) {
+                int t                    = model[i];
+                model[i]                 = model[model_len - 1 - i];
+                model[model_len - 1 - i] = t;
+            }
+        } else {
+            // 查找：按地址或按值，命中时深度为位置 + 1，落空时为链表长度
+            int              key  = values[v];
+            zerolist_node_t* node = op < 7 ? zerolist_find(&list, &values[v])
+                                           : zerolist_search(&list, &key, same_value);
+            CHECK(node == NULL ? at < 0 : at >= 0 && node->data == &values[v]);
+            // zerolist_search 总是经过自组织路径，但在空链表上直接返回；zerolist_find 只在
+            // 策略不为 NONE 时经过，成员索引的快速否定在此之前返回
+            bool counted = op >= 7 ? model_len > 0 : policy != ZEROLIST_SEARCH_NONE;
+#if ZEROLIST_UNIQUE_ENABLE
+            if (op < 7 && at < 0) counted = false;
+#endif
+            if (counted) {
+                expect.searches++;
+                if (at >= 0) {
+                    expect.found++;
+                    expect.probes += (uint64_t)at + 1;
+                    model_promote(policy, at);
+                } else {
+                    expect.probes += (uint64_t)model_len;
+                }
+            }
+        }
+        check_model();
+        zerolist_search_stats_t stats = zerolist_get_search_stats(&list);
+        CHECK(stats.searches == expect.searches && stats.found == expect.found
+              && stats.probes == expect.probes);
+    }
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+    for (int i = 0; i < POOL_NODES; i++) {
+        values[i] = i * 7 + 3;
+    }
+
+    // 1. 每种策略都与参考模型一致
+    run_policy(ZEROLIST_SEARCH_NONE);
+    run_policy(ZEROLIST_SEARCH_MOVE_TO_FRONT);
+    run_policy(ZEROLIST_SEARCH_TRANSPOSE);
+    run_policy(ZEROLIST_SEARCH_COUNT);
+
+    // 2. 热点访问：移到表头后平均探测深度接近热点集合大小，远小于链表长度的一半
+    zerolist_clear(&list);
+    for (int i = 0; i < POOL_NODES; i++) {
+        CHECK(zerolist_push_back(&list, &values[i]));
+    }
+    zerolist_set_search_policy(&list, ZEROLIST_SEARCH_MOVE_TO_FRONT);
+    for (int i = 0; i < STEPS; i++) {
+        zerolist_find(&list, &values[POOL_NODES - 1 - next_rand(HOT)]);
+    }
+    zerolist_reset_search_stats(&list);
+    for (int i = 0; i < STEPS; i++) {
+        zerolist_find(&list, &values[POOL_NODES - 1 - next_rand(HOT)]);
+    }
+    zerolist_search_stats_t stats = zerolist_get_search_stats(&list);
+    CHECK(stats.searches == STEPS && stats.found == STEPS);
+    CHECK(stats.probes <= (uint64_t)STEPS * HOT);
+
+    // 3. 无效策略被忽略
+    zerolist_set_search_policy(&list, ZEROLIST_SEARCH_COUNT + 1);
+    CHECK(list.search_policy == ZEROLIST_SEARCH_MOVE_TO_FRONT);
+
+    zerolist_destroy(&list);
+    printf("self_organize: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
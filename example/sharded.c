@@ -0,0 +1,121 @@
+/**
+ * @file sharded.c
+ * @brief 分片链表检查：多个生产者并发追加，一个消费者并发汇总
+ *
+ * 每个生产者线程向本地分片追加带序号的数据（分片满时重试），主线程同时反复 drain；
+ * 确认每条数据恰好取出一次、同一生产者的数据按追加顺序取出，并核对 size/foreach。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：sharded
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define SHARDS     4
+#define SHARD_SIZE 256
+#define PRODUCERS  4
+#define PER_THREAD 20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+typedef struct
+{
+    int producer;
+    int seq;
+} Item;
+
+static Item items[PRODUCERS][PER_THREAD];
+static int  next_seq[PRODUCERS];  // 每个生产者下一条应取出的序号
+static int  done_producers;       // 已结束的生产者数（原子操作）
+static int  errors;
+
+ZEROLIST_SHARDED_DEFINE(queue, SHARDS, SHARD_SIZE);
+
+static void* produce(void* arg)
+{
+    Item*    mine  = (Item*)arg;
+    uint32_t shard = zerolist_sharded_local(&queue);
+    for (int i = 0; i < PER_THREAD; i++) {
+        while (!zerolist_sharded_push_back(&queue, shard, &mine[i])) {
+            sched_yield();
+        }
+    }
+    __atomic_add_fetch(&done_producers, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void consume(void* data, void* ctx)
+{
+    const Item* it = (const Item*)data;
+    (void)ctx;
+    CHECK(it->seq == next_seq[it->producer]);
+    next_seq[it->producer] = it->seq + 1;
+}
+
+static int visited;
+
+static void visit(void* data)
+{
+    (void)data;
+    visited++;
+}
+
+static void discard(void* data, void* ctx)
+{
+    (void)data;
+    (void)ctx;
+}
+
+int main(void)
+{
+    CHECK(ZEROLIST_SHARDED_INIT(queue));
+
+    // 1. 单线程：size / foreach 覆盖所有分片
+    for (int i = 0; i < 10; i++) {
+        CHECK(zerolist_sharded_push_back(&queue, (uint32_t)i, &items[0][i]));
+    }
+    CHECK(zerolist_sharded_size(&queue) == 10);
+    zerolist_sharded_foreach(&queue, visit);
+    CHECK(visited == 10);
+    CHECK(zerolist_sharded_drain(&queue, discard, NULL) == 10);
+    CHECK(zerolist_sharded_size(&queue) == 0);
+
+    // 2. 并发：生产者追加的同时消费者持续汇总
+    pthread_t threads[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++) {
+        for (int i = 0; i < PER_THREAD; i++) {
+            items[p][i].producer = p;
+            items[p][i].seq      = i;
+        }
+        CHECK(pthread_create(&threads[p], NULL, produce, items[p]) == 0);
+    }
+    size_t taken = 0;
+    while (__atomic_load_n(&done_producers, __ATOMIC_ACQUIRE) < PRODUCERS) {
+        taken += zerolist_sharded_drain(&queue, consume, NULL);
+    }
+    for (int p = 0; p < PRODUCERS; p++) {
+        pthread_join(threads[p], NULL);
+    }
+    taken += zerolist_sharded_drain(&queue, consume, NULL);
+
+    CHECK(taken == (size_t)PRODUCERS * PER_THREAD);
+    for (int p = 0; p < PRODUCERS; p++) {
+        CHECK(next_seq[p] == PER_THREAD);
+    }
+    CHECK(zerolist_sharded_size(&queue) == 0);
+
+    zerolist_sharded_destroy(&queue);
+    printf("sharded: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
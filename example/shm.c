@@ -0,0 +1,111 @@
+/**
+ * @file shm.c
+ * @brief 跨进程共享内存队列检查：zerolist_shm_*
+ *
+ * 父进程创建区域后 fork 出生产者，生产者重新映射区域（映射地址与父进程不同），
+ * 在预留的槽位中写入递增序号并发布；父进程同时取出、核对顺序并归还槽位。
+ * 另外在单进程内确认池满、重复发布与外来指针都被拒绝。任何不一致都以非零退出码结束。
+ *
+ * 用法：shm
+ */
+
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../zerolist.h"
+
+#define NODE_COUNT 32
+#define MESSAGES   20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static char name[64];
+static int  errors;
+
+// 生产者：在自己的映射中预留、写入、发布
+static int produce(void)
+{
+    zerolist_shm_t shm;
+    if (!zerolist_shm_open(&shm, name)) return 1;
+    for (uint32_t seq = 0; seq < MESSAGES; seq++) {
+        uint32_t* slot;
+        while (!(slot = (uint32_t*)zerolist_shm_alloc(&shm))) {
+            sched_yield();
+        }
+        *slot = seq;
+        if (!zerolist_shm_push_back(&shm, slot)) return 1;
+    }
+    zerolist_shm_close(&shm);
+    return 0;
+}
+
+int main(void)
+{
+    snprintf(name, sizeof(name), "/zerolist_check_%ld", (long)getpid());
+    zerolist_shm_t shm;
+    CHECK(zerolist_shm_create(&shm, name, NODE_COUNT, sizeof(uint32_t)));
+    if (errors) {
+        printf("shm: FAILED\n");
+        return 1;
+    }
+    zerolist_shm_t again;
+    CHECK(!zerolist_shm_create(&again, name, NODE_COUNT, sizeof(uint32_t)));
+
+    // 1. 单进程：池满返回 NULL，重复发布与外来指针被拒绝
+    void*    slots[NODE_COUNT];
+    uint32_t local = 0;
+    for (int i = 0; i < NODE_COUNT; i++) {
+        slots[i] = zerolist_shm_alloc(&shm);
+        CHECK(slots[i] != NULL);
+    }
+    CHECK(zerolist_shm_alloc(&shm) == NULL);
+    CHECK(!zerolist_shm_push_back(&shm, &local));
+    CHECK(zerolist_shm_push_back(&shm, slots[0]));
+    CHECK(!zerolist_shm_push_back(&shm, slots[0]));
+    CHECK(zerolist_shm_size(&shm) == 1);
+    CHECK(zerolist_shm_pop_front(&shm) == slots[0]);
+    CHECK(zerolist_shm_pop_front(&shm) == NULL);
+    for (int i = 0; i < NODE_COUNT; i++) {
+        zerolist_shm_free(&shm, slots[i]);
+    }
+    CHECK(zerolist_shm_size(&shm) == 0);
+
+    // 2. 跨进程：生产者与消费者并发，消息按发布顺序到达
+    pid_t pid = fork();
+    if (pid == 0) _exit(produce());
+    CHECK(pid > 0);
+    uint32_t expected = 0;
+    int      status   = 0;
+    bool     exited   = pid <= 0;
+    while (expected < MESSAGES && !errors) {
+        uint32_t* slot = (uint32_t*)zerolist_shm_pop_front(&shm);
+        if (!slot) {
+            // 生产者已经退出且队列为空：剩余消息不会再到达
+            if (exited) break;
+            exited = waitpid(pid, &status, WNOHANG) == pid;
+            continue;
+        }
+        CHECK(*slot == expected);
+        expected++;
+        zerolist_shm_free(&shm, slot);
+    }
+    if (!exited) waitpid(pid, &status, 0);
+    CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    CHECK(expected == MESSAGES);
+    CHECK(zerolist_shm_size(&shm) == 0);
+
+    zerolist_shm_close(&shm);
+    CHECK(zerolist_shm_unlink(name));
+    CHECK(!zerolist_shm_open(&shm, name));
+    printf("shm: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
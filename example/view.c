@@ -0,0 +1,132 @@
+/**
+ * @file view.c
+ * @brief 子链表视图检查：zerolist_view_* 的读取与失效
+ *
+ * 确认视图按节点或下标截取正确的一段，链表的每种结构修改都会使视图失效，
+ * 包括销毁后重新初始化、节点槽位被复用成与创建时相同形状的情形。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：view
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define POOL_NODES 16
+#define ITEM_COUNT 10
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int items[ITEM_COUNT];
+static int errors;
+
+ZEROLIST_DEFINE(list, POOL_NODES);
+
+static bool same_value(const void* a, const void* b)
+{
+    return *(const int*)a == *(const int*)b;
+}
+
+static void fill(void)
+{
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        zerolist_push_back(&list, &items[i]);
+    }
+}
+
+static void open_view(zerolist_view_t* view)
+{
+    CHECK(zerolist_view_from_index(view, &list, 2, 4));
+    CHECK(zerolist_view_valid(view));
+}
+
+int main(void)
+{
+    for (int i = 0; i < ITEM_COUNT; i++) {
+        items[i] = i * 10;
+    }
+    ZEROLIST_INIT(list);
+    fill();
+
+    // 1. 读取：下标、地址查找、比较函数查找；越过链表尾部时提前结束
+    zerolist_view_t view;
+    open_view(&view);
+    CHECK(zerolist_view_at(&view, 0) == &items[2]);
+    CHECK(zerolist_view_at(&view, 3) == &items[5]);
+    CHECK(zerolist_view_at(&view, 4) == NULL);
+    CHECK(zerolist_view_find(&view, &items[4]) != NULL);
+    CHECK(zerolist_view_find(&view, &items[6]) == NULL);
+    int probe = 30;
+    CHECK(zerolist_view_search(&view, &probe, same_value)->data == &items[3]);
+    int n = 0;
+    ZEROLIST_VIEW_FOR_EACH(&view, node)
+    {
+        CHECK(node->data == &items[2 + n]);
+        n++;
+    }
+    CHECK(n == 4);
+    CHECK(zerolist_view_from_node(&view, &list, zerolist_find(&list, &items[8]), 5));
+    n = 0;
+    ZEROLIST_VIEW_FOR_EACH(&view, node)
+    {
+        (void)node;
+        n++;
+    }
+    CHECK(n == 2);
+    CHECK(!zerolist_view_from_index(&view, &list, ITEM_COUNT, 1));
+
+    // 2. 每种结构修改都使视图失效，失效视图的读取返回空结果
+    open_view(&view);
+    zerolist_push_back(&list, &items[0]);
+    CHECK(!zerolist_view_valid(&view));
+    CHECK(zerolist_view_at(&view, 0) == NULL);
+    CHECK(zerolist_view_find(&view, &items[2]) == NULL);
+
+    open_view(&view);
+    zerolist_pop_back(&list);
+    CHECK(!zerolist_view_valid(&view));
+
+    open_view(&view);
+    zerolist_reverse(&list);
+    CHECK(!zerolist_view_valid(&view));
+    zerolist_reverse(&list);
+
+    open_view(&view);
+    zerolist_remove_ptr(&list, &items[9]);
+    CHECK(!zerolist_view_valid(&view));
+
+    open_view(&view);
+    zerolist_clear(&list);
+    CHECK(!zerolist_view_valid(&view));
+
+    // 3. 销毁后重新初始化：之后以相同的操作序列重建出相同形状的链表，旧视图仍然失效
+    zerolist_destroy(&list);
+    CHECK(zerolist_reinit(&list, POOL_NODES));
+    fill();
+    open_view(&view);
+    zerolist_destroy(&list);
+    CHECK(zerolist_reinit(&list, POOL_NODES));
+    CHECK(!zerolist_view_valid(&view));
+    fill();
+    CHECK(!zerolist_view_valid(&view));
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 4. 静态缓冲区直接重新初始化
+    open_view(&view);
+    ZEROLIST_INIT(list);
+    CHECK(!zerolist_view_valid(&view));
+    fill();
+#endif
+
+    zerolist_destroy(&list);
+    printf("view: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
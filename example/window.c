@@ -0,0 +1,172 @@
+/**
+ * @file window.c
+ * @brief 固定窗口检查：zerolist_push_back_evict
+ *
+ * 持续追加远多于节点池容量的数据，并穿插删除与反转；确认链表始终等于参考窗口
+ * （最近追加、未被删除的至多 N 条），被淘汰的数据按先进先出返回。开启附加功能时
+ * 还确认原地改写的节点同步更新了成员索引、布隆过滤器、键指纹与汇总值。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：window
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define WINDOW 16
+#define STEPS  20000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[STEPS];
+static void*    model[WINDOW];  // 参考窗口，按链表逻辑顺序
+static int      model_len;
+static unsigned seed = 53u;
+static int      errors;
+
+ZEROLIST_DEFINE(list, WINDOW);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+#if ZEROLIST_KEY_ENABLE
+static ZEROLIST_KEY_TYPE key_of(const void* data)
+{
+    return (ZEROLIST_KEY_TYPE)*(const int*)data;
+}
+#endif
+
+#if ZEROLIST_AGGREGATE_ENABLE
+static ZEROLIST_AGG_TYPE get_value(const void* data)
+{
+    return *(const int*)data;
+}
+
+static ZEROLIST_AGG_TYPE add(ZEROLIST_AGG_TYPE a, ZEROLIST_AGG_TYPE b)
+{
+    return a + b;
+}
+
+static ZEROLIST_AGG_TYPE max_of(ZEROLIST_AGG_TYPE a, ZEROLIST_AGG_TYPE b)
+{
+    return a > b ? a : b;
+}
+
+static const zerolist_monoid_t window_max = { -1, max_of, get_value, NULL, true };
+static const zerolist_monoid_t window_sum = { 0, add, get_value, NULL, false };
+#endif
+
+static void model_remove(int i)
+{
+    for (; i + 1 < model_len; i++) {
+        model[i] = model[i + 1];
+    }
+    model_len--;
+}
+
+static void check_window(void)
+{
+    int i = 0;
+    ZEROLIST_FOR_EACH(&list, node)
+    {
+        CHECK(i < model_len && node->data == model[i]);
+        i++;
+    }
+    CHECK(i == model_len && (int)zerolist_size(&list) == model_len);
+}
+
+// 附加功能：被淘汰的数据不再可见，窗口内的数据都能找到
+static void check_features(void* gone)
+{
+#if ZEROLIST_UNIQUE_ENABLE
+    if (gone) CHECK(!zerolist_contains(&list, gone));
+#endif
+#if ZEROLIST_KEY_ENABLE
+    if (gone) CHECK(zerolist_search_key(&list, key_of(gone), gone, NULL) == NULL);
+#endif
+    for (int i = 0; i < model_len; i++) {
+#if ZEROLIST_UNIQUE_ENABLE
+        CHECK(zerolist_contains(&list, model[i]));
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+        CHECK(zerolist_may_contain(&list, model[i]));
+#endif
+#if ZEROLIST_KEY_ENABLE
+        zerolist_node_t* hit = zerolist_search_key(&list, key_of(model[i]), model[i], NULL);
+        CHECK(hit && hit->data == model[i]);
+#endif
+    }
+#if ZEROLIST_AGGREGATE_ENABLE
+    ZEROLIST_AGG_TYPE expect = list.monoid->identity;
+    for (int i = 0; i < model_len; i++) {
+        expect = list.monoid->combine(expect, get_value(model[i]));
+    }
+    CHECK(zerolist_aggregate(&list) == expect);
+#endif
+    (void)gone;
+}
+
+int main(void)
+{
+    ZEROLIST_INIT(list);
+#if ZEROLIST_KEY_ENABLE
+    zerolist_set_key_func(&list, key_of);
+#endif
+#if ZEROLIST_AGGREGATE_ENABLE
+    zerolist_set_monoid(&list, &window_max);
+#endif
+
+    for (int step = 0; step < STEPS && !errors; step++) {
+        values[step] = (step * 40503) & 0xffff;  // 互不相同且无序，键查找不受重复值干扰
+        int op       = next_rand(20);
+        if (op == 0 && model_len) {
+            int i = next_rand(model_len);
+            CHECK(zerolist_remove_ptr(&list, model[i]));
+            model_remove(i);
+        } else if (op == 1 && model_len) {
+            CHECK(zerolist_pop_front(&list) == model[0]);
+            model_remove(0);
+        } else if (op == 2) {
+            zerolist_reverse(&list);
+            for (int i = 0; i < model_len / 2; i++) {
+                void* t                  = model[i];
+                model[i]                 = model[model_len - 1 - i];
+                model[model_len - 1 - i] = t;
+            }
+        }
+#if ZEROLIST_AGGREGATE_ENABLE
+        else if (op == 3) {
+            // 按不可交换处理的求和：窗口淘汰走双栈的头部删除 + 尾部插入
+            zerolist_set_monoid(&list, list.monoid == &window_max ? &window_sum : &window_max);
+        }
+#endif
+
+        void* evicted = &values[0];
+        CHECK(zerolist_push_back_evict(&list, &values[step], &evicted));
+        void* gone = NULL;
+        if (model_len == WINDOW) {
+            gone = model[0];
+            model_remove(0);
+        }
+        CHECK(evicted == gone);
+        model[model_len++] = &values[step];
+
+        check_window();
+        check_features(gone);
+    }
+
+    zerolist_destroy(&list);
+    printf("window: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file wsdeque.c
+ * @brief 工作窃取双端队列检查：zerolist_wsdeque_*
+ *
+ * 单线程下按参考模型随机执行 push/pop/steal，确认底端后进先出、顶端先进先出，
+ * 缓冲区写满时按模式扩容或拒绝；多线程下所有者压入并弹出任务的同时多个窃取者
+ * 从顶端窃取（初始容量很小，窃取期间反复扩容），确认每个任务恰好被取走一次。
+ * 任何不一致都以非零退出码结束。
+ *
+ * 用法：wsdeque
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../zerolist.h"
+
+#define CAPACITY 8
+#define STEPS    20000
+#define THIEVES  3
+#define TASKS    200000
+
+#define CHECK(cond)                                                    \
+    do {                                                               \
+        if (!(cond)) {                                                 \
+            printf("  check failed: %s (line %d)\n", #cond, __LINE__); \
+            errors++;                                                  \
+        }                                                              \
+    } while (0)
+
+static int      values[STEPS];
+static void*    model[STEPS];  // 参考模型：model[lo..hi) 为队列内容，顶端在 lo
+static int      lo, hi;
+static unsigned seed = 113u;
+static int      errors;
+
+ZEROLIST_WSDEQUE_DEFINE(deque, CAPACITY);
+
+static int next_rand(int range)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (int)((seed >> 16) % (unsigned)range);
+}
+
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+#define GROWS 1
+#else
+#define GROWS 0
+#endif
+
+#if GROWS
+static int     tasks[TASKS];
+static uint8_t taken[TASKS];  // 每个任务被取走的次数（原子操作）
+static int     owner_done;    // 所有者已结束（原子操作）
+
+static void take(void* task)
+{
+    __atomic_add_fetch(&taken[(int*)task - tasks], 1, __ATOMIC_RELAXED);
+}
+
+static void* steal_loop(void* arg)
+{
+    (void)arg;
+    while (!__atomic_load_n(&owner_done, __ATOMIC_ACQUIRE) || zerolist_wsdeque_size(&deque)) {
+        void* task = zerolist_wsdeque_steal(&deque);
+        if (task) {
+            take(task);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+#endif
+
+int main(void)
+{
+    CHECK(ZEROLIST_WSDEQUE_INIT(deque));
+    CHECK(zerolist_wsdeque_pop(&deque) == NULL);
+    CHECK(zerolist_wsdeque_steal(&deque) == NULL);
+    CHECK(!zerolist_wsdeque_push(&deque, NULL));
+
+    // 1. 单线程：与参考模型逐步比较
+    int pushed = 0;
+    for (int step = 0; step < STEPS && !errors; step++) {
+        int op = next_rand(5);
+        if (op < 2) {
+            bool ok = zerolist_wsdeque_push(&deque, &values[pushed]);
+            CHECK(ok == (GROWS || hi - lo < CAPACITY));
+            if (ok) model[hi++] = &values[pushed++];
+        } else if (op == 2) {
+            void* task = zerolist_wsdeque_pop(&deque);
+            CHECK(task == (hi > lo ? model[hi - 1] : NULL));
+            if (hi > lo) hi--;
+        } else if (op == 3) {
+            void* task = zerolist_wsdeque_steal(&deque);
+            CHECK(task == (hi > lo ? model[lo] : NULL));
+            if (hi > lo) lo++;
+        } else if (hi == lo) {
+            // 队列为空时把模型窗口移回起点，避免耗尽参考数组
+            lo = hi = 0;
+        }
+        CHECK(zerolist_wsdeque_size(&deque) == (size_t)(hi - lo));
+        if (pushed == STEPS) break;
+    }
+    while (zerolist_wsdeque_pop(&deque)) {
+    }
+
+#if GROWS
+    // 2. 并发：所有者压入并随机弹出，窃取者同时从顶端窃取
+    for (int i = 0; i < TASKS; i++) {
+        tasks[i] = i;
+    }
+    pthread_t threads[THIEVES];
+    for (int t = 0; t < THIEVES; t++) {
+        CHECK(pthread_create(&threads[t], NULL, steal_loop, NULL) == 0);
+    }
+    for (int i = 0; i < TASKS; i++) {
+        CHECK(zerolist_wsdeque_push(&deque, &tasks[i]));
+        if (next_rand(3) == 0) {
+            void* task = zerolist_wsdeque_pop(&deque);
+            if (task) take(task);
+        }
+    }
+    for (void* task; (task = zerolist_wsdeque_pop(&deque));) {
+        take(task);
+    }
+    __atomic_store_n(&owner_done, 1, __ATOMIC_RELEASE);
+    for (int t = 0; t < THIEVES; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    for (int i = 0; i < TASKS; i++) {
+        CHECK(taken[i] == 1);
+        if (errors > 10) break;
+    }
+#endif
+
+    zerolist_wsdeque_destroy(&deque);
+    printf("wsdeque: %s\n", errors ? "FAILED" : "ok");
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,204 @@
+/**
+ * @file wsdeque_bench.c
+ * @brief 工作窃取调度器基准：zerolist_wsdeque 对比“每个 worker 一条加锁 Zerolist”
+ *
+ * 每个任务是一棵二叉任务树的节点：非叶子任务派生两个子任务，叶子任务做一小段计算。
+ * worker 优先处理本地队列（LIFO），本地为空时随机挑选其他 worker 窃取（FIFO）。
+ *
+ * 用法：wsdeque_bench [workers] [depth]
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../zerolist.h"
+
+#define MAX_WORKERS   64
+#define DEFAULT_DEPTH 18
+#define LEAF_WORK     200
+#define POOL_NODES    1024
+
+// 任务直接编码为指针：深度 + 1（保证非 NULL）
+#define TASK_MAKE(depth)  ((void*)(uintptr_t)((depth) + 1))
+#define TASK_DEPTH(task)  ((int)((uintptr_t)(task) - 1))
+
+typedef struct
+{
+    zerolist_wsdeque_t deque;
+    pthread_mutex_t    lock;
+    Zerolist           list;
+    unsigned           seed;
+    uint64_t           steals;
+    uint64_t           sink;
+} Worker;
+
+static Worker   workers[MAX_WORKERS];
+static int      worker_count;
+static int      use_locked;
+static int64_t  pending;
+static uint64_t leaf_total;
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1e6;
+}
+
+static uint64_t run_leaf(uint64_t x)
+{
+    for (int i = 0; i < LEAF_WORK; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return x;
+}
+
+// ===========================================
+// 两种任务队列实现
+// ===========================================
+
+static int queue_push(Worker* w, void* task)
+{
+    if (!use_locked) return zerolist_wsdeque_push(&w->deque, task);
+
+    pthread_mutex_lock(&w->lock);
+    int ok = zerolist_push_back(&w->list, task);
+    pthread_mutex_unlock(&w->lock);
+    return ok;
+}
+
+static void* queue_pop(Worker* w)
+{
+    if (!use_locked) return zerolist_wsdeque_pop(&w->deque);
+
+    pthread_mutex_lock(&w->lock);
+    void* task = zerolist_pop_back(&w->list);
+    pthread_mutex_unlock(&w->lock);
+    return task;
+}
+
+static void* queue_steal(Worker* w)
+{
+    if (!use_locked) return zerolist_wsdeque_steal(&w->deque);
+
+    pthread_mutex_lock(&w->lock);
+    void* task = zerolist_pop_front(&w->list);
+    pthread_mutex_unlock(&w->lock);
+    return task;
+}
+
+// ===========================================
+// 调度循环
+// ===========================================
+
+static void spawn(Worker* w, void* task)
+{
+    __atomic_add_fetch(&pending, 1, __ATOMIC_RELAXED);
+    if (!queue_push(w, task)) {
+        fprintf(stderr, "push failed\n");
+        exit(1);
+    }
+}
+
+static void execute(Worker* w, void* task)
+{
+    int depth = TASK_DEPTH(task);
+    if (depth == 0) {
+        w->sink += run_leaf(w->sink + (uint64_t)depth);
+        __atomic_add_fetch(&leaf_total, 1, __ATOMIC_RELAXED);
+    } else {
+        spawn(w, TASK_MAKE(depth - 1));
+        spawn(w, TASK_MAKE(depth - 1));
+    }
+    __atomic_sub_fetch(&pending, 1, __ATOMIC_RELEASE);
+}
+
+static void* worker_main(void* arg)
+{
+    Worker* w = (Worker*)arg;
+
+    while (__atomic_load_n(&pending, __ATOMIC_ACQUIRE) > 0) {
+        void* task = queue_pop(w);
+        if (!task && worker_count > 1) {
+            int victim = (int)(rand_r(&w->seed) % (unsigned)worker_count);
+            if (&workers[victim] != w) {
+                task = queue_steal(&workers[victim]);
+                if (task) w->steals++;
+            }
+        }
+        if (task) {
+            execute(w, task);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static double run(int locked, int depth)
+{
+    use_locked = locked;
+    pending    = 0;
+    leaf_total = 0;
+    for (int i = 0; i < worker_count; i++) {
+        Worker* w = &workers[i];
+        w->seed   = (unsigned)(i + 1) * 2654435761u;
+        w->steals = 0;
+        w->sink   = 0;
+        if (locked) {
+            pthread_mutex_init(&w->lock, NULL);
+            list_init_dynamic_expand(&w->list, POOL_NODES);
+        } else if (!zerolist_wsdeque_init(&w->deque, NULL, POOL_NODES)) {
+            fprintf(stderr, "wsdeque init failed\n");
+            exit(1);
+        }
+    }
+
+    pthread_t threads[MAX_WORKERS];
+    double    start = now_ms();
+    spawn(&workers[0], TASK_MAKE(depth));
+    for (int i = 0; i < worker_count; i++) {
+        pthread_create(&threads[i], NULL, worker_main, &workers[i]);
+    }
+    for (int i = 0; i < worker_count; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    double elapsed = now_ms() - start;
+
+    uint64_t steals = 0;
+    for (int i = 0; i < worker_count; i++) {
+        Worker* w = &workers[i];
+        steals += w->steals;
+        if (locked) {
+            zerolist_destroy(&w->list);
+            pthread_mutex_destroy(&w->lock);
+        } else {
+            zerolist_wsdeque_destroy(&w->deque);
+        }
+    }
+    printf("  %-16s %9.2f ms  leaves=%llu steals=%llu\n", locked ? "locked zerolist" : "wsdeque",
+           elapsed, (unsigned long long)leaf_total, (unsigned long long)steals);
+    return elapsed;
+}
+
+int main(int argc, char** argv)
+{
+    long cpus    = sysconf(_SC_NPROCESSORS_ONLN);
+    worker_count = argc > 1 ? atoi(argv[1]) : (int)(cpus > 0 ? cpus : 1);
+    int depth    = argc > 2 ? atoi(argv[2]) : DEFAULT_DEPTH;
+    if (worker_count < 1) worker_count = 1;
+    if (worker_count > MAX_WORKERS) worker_count = MAX_WORKERS;
+    if (depth < 1 || depth > 26) depth = DEFAULT_DEPTH;
+
+    printf("work-stealing benchmark: %d workers, depth %d (%lu tasks)\n", worker_count, depth,
+           (unsigned long)((2UL << depth) - 1));
+    double locked = run(1, depth);
+    double ws     = run(0, depth);
+    printf("  speedup          %9.2fx\n", ws > 0 ? locked / ws : 0.0);
+    return 0;
+}
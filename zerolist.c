@@ -10,8 +10,24 @@
  * @note 使用说明与完整示例请参阅 README.md 与 example/example.c
  ****/
 
+// 共享内存模式用到 ftruncate 与健壮互斥锁（POSIX.1-2008），须在任何系统头文件之前声明
+#if defined(ZEROLIST_SHM_ENABLE) && ZEROLIST_SHM_ENABLE && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "zerolist.h"
 #include <string.h>
+#if ZEROLIST_SHM_ENABLE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if ZEROLIST_SHARD_ENABLE
+#include <sched.h>
+#endif
 #define ZEROLIST_SAFETY_LIMIT 65535
 // ===========================================
 // 内部宏定义（局部使用，不对外暴露）
@@ -86,6 +102,591 @@ static inline bool _zerolist_is_static_node(Zerolist* list, zerolist_node_t* nod
 #endif
 }
 
+// 按链表逻辑方向取前后节点（ZEROLIST_LAZY_REVERSE 时由 reversed 标志决定）
+#define _ZEROLIST_NEXT(list, node) ZEROLIST_NODE_NEXT(list, node)
+#define _ZEROLIST_PREV(list, node) ZEROLIST_NODE_PREV(list, node)
+
+// 数据预取提示（rw: 0=读, 1=写）
+#if defined(__GNUC__)
+#define _ZEROLIST_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw), 1)
+#else
+#define _ZEROLIST_PREFETCH(addr, rw) ((void)(addr))
+#endif
+
+// 结构修改计数（视图有效性检查）
+#if ZEROLIST_VIEW_ENABLE
+#define _ZEROLIST_MODIFIED(list) ((list)->mod_count++)
+#else
+#define _ZEROLIST_MODIFIED(list) ((void)0)
+#endif
+
+// 缓冲区链字段
+#if ZEROLIST_BUFCHAIN_ENABLE
+#define _ZEROLIST_BUF_RESET(node)    ((node)->len = (node)->off = 0)
+#define _ZEROLIST_BUF_COPY(dst, src) ((dst)->len = (src)->len, (dst)->off = (src)->off)
+#else
+#define _ZEROLIST_BUF_RESET(node)    ((void)0)
+#define _ZEROLIST_BUF_COPY(dst, src) ((void)0)
+#endif
+
+// 命中计数字段
+#if ZEROLIST_SELF_ORGANIZE
+#define _ZEROLIST_HITS_RESET(node)    ((node)->hits = 0)
+#define _ZEROLIST_HITS_COPY(dst, src) ((dst)->hits = (src)->hits)
+#else
+#define _ZEROLIST_HITS_RESET(node)    ((void)0)
+#define _ZEROLIST_HITS_COPY(dst, src) ((void)0)
+#endif
+
+// 节点附加字段：新节点清零，复制节点时随 data 一起复制
+#define _ZEROLIST_EXTRA_RESET(node)    (_ZEROLIST_BUF_RESET(node), _ZEROLIST_HITS_RESET(node))
+#define _ZEROLIST_EXTRA_COPY(dst, src) (_ZEROLIST_BUF_COPY(dst, src), _ZEROLIST_HITS_COPY(dst, src))
+
+// 按链表逻辑方向把 b 链接在 a 之后
+#if ZEROLIST_LAZY_REVERSE
+#define _ZEROLIST_LINK(list, a, b)   \
+    do {                             \
+        if ((list)->reversed) {      \
+            (a)->prev = (b);         \
+            (b)->next = (a);         \
+        } else {                     \
+            (a)->next = (b);         \
+            (b)->prev = (a);         \
+        }                            \
+    } while (0)
+#else
+#define _ZEROLIST_LINK(list, a, b) \
+    do {                           \
+        (a)->next = (b);           \
+        (b)->prev = (a);           \
+    } while (0)
+#endif
+
+#if ZEROLIST_DIRTY_TRACK
+// 标记节点所在槽位为脏（增量检查点）
+#define _ZEROLIST_DIRTY_MARK(list, node)                                 \
+    do {                                                                 \
+        if ((list)->dirty_bits) {                                        \
+            size_t _di = (size_t)((node) - (list)->node_buf);            \
+            (list)->dirty_bits[_di >> 3] |= (uint8_t)(1u << (_di & 7u)); \
+        }                                                                \
+    } while (0)
+
+// 标记所有槽位为脏（初始化、清空、缩容等整体操作）
+#define _ZEROLIST_DIRTY_MARK_ALL(list)                                                 \
+    do {                                                                               \
+        if ((list)->dirty_bits) {                                                      \
+            memset((list)->dirty_bits, 0xFF, ZEROLIST_DIRTY_BYTES((list)->max_nodes)); \
+        }                                                                              \
+    } while (0)
+
+// 记录空闲栈到达过的最低栈顶，检查点只需输出其上方的栈内容
+#if ZEROLIST_FAST_ALLOC
+#define _ZEROLIST_DIRTY_STACK_POP(list)                                 \
+    do {                                                                \
+        if ((list)->free_top < (list)->dirty_free_low) {                \
+            (list)->dirty_free_low = (list)->free_top;                  \
+        }                                                               \
+    } while (0)
+#endif
+#else
+#define _ZEROLIST_DIRTY_MARK(list, node) ((void)0)
+#define _ZEROLIST_DIRTY_MARK_ALL(list)   ((void)0)
+#define _ZEROLIST_DIRTY_STACK_POP(list)  ((void)0)
+#endif
+
+#if ZEROLIST_AGGREGATE_ENABLE
+// 初始化：清除幺半群
+#define _ZEROLIST_AGG_INIT(list)  \
+    do {                          \
+        (list)->monoid    = NULL; \
+        (list)->agg       = 0;    \
+        (list)->agg_front = 0;    \
+        (list)->agg_stale = 0;    \
+    } while (0)
+
+// 链表整体变空：汇总值回到单位元
+#define _ZEROLIST_AGG_EMPTY(list)                         \
+    do {                                                  \
+        if ((list)->monoid) {                             \
+            (list)->agg       = (list)->monoid->identity; \
+            (list)->agg_front = 0;                        \
+            (list)->agg_stale = 0;                        \
+        }                                                 \
+    } while (0)
+
+// 批量改动（克隆、反转、从数组重建等）：下次查询时重新计算
+#define _ZEROLIST_AGG_STALE(list) ((list)->agg_stale = 1)
+
+/*
+ * 不能 O(1) 删除的幺半群（不可逆或不可交换）使用双栈汇总：
+ * 表头起的 agg_front 个节点组成前段，每个节点的 agg 为它到前段末尾的后缀汇总；
+ * 其余节点组成后段，list->agg 为后段的汇总。总值 = head->agg · list->agg。
+ * 头部插入/删除与尾部插入均为 O(1)，前段耗尽后由下一次查询一次性重建为整个链表，
+ * 因此队列式使用（尾进头出）的均摊代价为 O(1)。
+ */
+#define _ZEROLIST_AGG_TWO_STACK(m) (!((m)->commutative && (m)->uncombine))
+
+// 当前汇总值（调用方保证未失效）
+static inline ZEROLIST_AGG_TYPE _zerolist_agg_total(const Zerolist* list)
+{
+    const zerolist_monoid_t* m = list->monoid;
+    if (!_ZEROLIST_AGG_TWO_STACK(m) || !list->agg_front) return list->agg;
+    return m->combine(list->head->agg, list->agg);
+}
+
+// 节点相对顺序即将改变（移动、反转）：可交换时把前段并入后段，否则标记失效
+static inline void _zerolist_agg_reorder(Zerolist* list)
+{
+    const zerolist_monoid_t* m = list->monoid;
+    if (!m || list->agg_stale) return;
+    if (!m->commutative) {
+        list->agg_stale = 1;
+    } else if (_ZEROLIST_AGG_TWO_STACK(m)) {
+        list->agg       = _zerolist_agg_total(list);
+        list->agg_front = 0;
+    }
+}
+#define _ZEROLIST_AGG_REORDER(list) _zerolist_agg_reorder(list)
+#else
+#define _ZEROLIST_AGG_INIT(list)  ((void)0)
+#define _ZEROLIST_AGG_EMPTY(list) ((void)0)
+#define _ZEROLIST_AGG_STALE(list)   ((void)0)
+#define _ZEROLIST_AGG_REORDER(list) ((void)0)
+#endif
+
+#if ZEROLIST_SELF_ORGANIZE
+#define _ZEROLIST_SEARCH_INIT(list)                                      \
+    do {                                                                 \
+        (list)->search_policy = ZEROLIST_SEARCH_NONE;                    \
+        memset(&(list)->search_stats, 0, sizeof((list)->search_stats)); \
+    } while (0)
+#else
+#define _ZEROLIST_SEARCH_INIT(list) ((void)0)
+#endif
+
+#if ZEROLIST_KEY_ENABLE
+#define _ZEROLIST_KEY_INIT(list) ((list)->key_func = NULL)
+
+// 按链表的键提取函数写入节点的键
+#define _ZEROLIST_KEY_SET(list, node)                                       \
+    do {                                                                    \
+        if ((list)->key_func) (node)->key = (list)->key_func((node)->data); \
+    } while (0)
+
+// 为链表中所有节点重新计算键（克隆、从数组重建等批量改动后调用）
+static void _zerolist_key_fill(Zerolist* list)
+{
+    zerolist_node_t* cur = list->head;
+    if (!cur) return;
+    do {
+        cur->key = list->key_func(cur->data);
+        cur      = cur->next;
+    } while (cur != list->head);
+}
+#define _ZEROLIST_KEY_REFILL(list)                      \
+    do {                                                \
+        if ((list)->key_func) _zerolist_key_fill(list); \
+    } while (0)
+#else
+#define _ZEROLIST_KEY_INIT(list)      ((void)0)
+#define _ZEROLIST_KEY_SET(list, node) ((void)0)
+#define _ZEROLIST_KEY_REFILL(list)    ((void)0)
+#endif
+
+// 指针混合哈希（splitmix64 终结函数），高低 32 位可分别使用
+static inline uint64_t _zerolist_ptr_hash(const void* data)
+{
+    uint64_t h = (uint64_t)(uintptr_t)data;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+#if ZEROLIST_BLOOM_ENABLE
+// 动态模式下过滤器的初始容量（节点数）
+#define _ZEROLIST_BLOOM_MIN_NODES 16
+
+// 第 i 个计数器下标：h1 + i·h2（h1/h2 取哈希的低/高 32 位），再用乘法取高位映射到 [0, slots)
+static inline size_t _zerolist_bloom_slot(uint64_t h, uint32_t i, size_t slots)
+{
+    uint32_t x = (uint32_t)h + i * ((uint32_t)(h >> 32) | 1u);
+    return (size_t)(((uint64_t)x * slots) >> 32);
+}
+
+static void _zerolist_bloom_add(uint8_t* bloom, size_t slots, const void* data)
+{
+    uint64_t h = _zerolist_ptr_hash(data);
+    for (uint32_t i = 0; i < ZEROLIST_BLOOM_HASHES; i++) {
+        uint8_t* c = &bloom[_zerolist_bloom_slot(h, i, slots)];
+        if (*c != UINT8_MAX) (*c)++;
+    }
+}
+
+static void _zerolist_bloom_del(uint8_t* bloom, size_t slots, const void* data)
+{
+    uint64_t h = _zerolist_ptr_hash(data);
+    for (uint32_t i = 0; i < ZEROLIST_BLOOM_HASHES; i++) {
+        uint8_t* c = &bloom[_zerolist_bloom_slot(h, i, slots)];
+        // 饱和的计数器不再递减，避免假阴性
+        if (*c != 0 && *c != UINT8_MAX) (*c)--;
+    }
+}
+
+// 动态模式下记录过滤器中的元素数，按它而不是 size 决定何时扩大（ZEROLIST_SIZE_ENABLE=0 时同样有效）
+#if ZEROLIST_USE_MALLOC
+#define _ZEROLIST_BLOOM_ITEMS_SET(list, n) ((list)->bloom_items = (n))
+#define _ZEROLIST_BLOOM_ITEMS_INC(list)    ((list)->bloom_items++)
+#define _ZEROLIST_BLOOM_ITEMS_DEC(list)    ((list)->bloom_items -= (list)->bloom_items != 0)
+#else
+#define _ZEROLIST_BLOOM_ITEMS_SET(list, n) ((void)0)
+#define _ZEROLIST_BLOOM_ITEMS_INC(list)    ((void)0)
+#define _ZEROLIST_BLOOM_ITEMS_DEC(list)    ((void)0)
+#endif
+
+// 按链表当前内容重新填充计数器；待回收环中的节点释放时才递减，因此一并计入
+static void _zerolist_bloom_fill(Zerolist* list)
+{
+    memset(list->bloom, 0, list->bloom_slots);
+    _ZEROLIST_BLOOM_ITEMS_SET(list, 0);
+    zerolist_node_t* rings[2] = { list->head, list->reclaim };
+    for (int r = 0; r < 2; r++) {
+        zerolist_node_t* cur = rings[r];
+        if (!cur) continue;
+        do {
+            _zerolist_bloom_add(list->bloom, list->bloom_slots, cur->data);
+            _ZEROLIST_BLOOM_ITEMS_INC(list);
+            cur = cur->next;
+        } while (cur != rings[r]);
+    }
+}
+
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+// 以 nodes 个节点的容量重新分配并重建过滤器；分配失败时保留原过滤器（仍然有效）
+static void _zerolist_bloom_resize(Zerolist* list, size_t nodes)
+{
+    size_t   slots = nodes * ZEROLIST_BLOOM_RATIO;
+    uint8_t* bloom = (uint8_t*)ZEROLIST_MALLOC(slots);
+    if (!bloom) return;
+    if (list->bloom) ZEROLIST_FREE(list->bloom);
+    list->bloom       = bloom;
+    list->bloom_slots = slots;
+    _zerolist_bloom_fill(list);
+}
+#endif
+
+#define _ZEROLIST_BLOOM_ADD(list, data)                                       \
+    do {                                                                      \
+        if ((list)->bloom) {                                                  \
+            _zerolist_bloom_add((list)->bloom, (list)->bloom_slots, (data)); \
+            _ZEROLIST_BLOOM_ITEMS_INC(list);                                  \
+        }                                                                     \
+    } while (0)
+#define _ZEROLIST_BLOOM_DEL(list, data)                                       \
+    do {                                                                      \
+        if ((list)->bloom) {                                                  \
+            _zerolist_bloom_del((list)->bloom, (list)->bloom_slots, (data)); \
+            _ZEROLIST_BLOOM_ITEMS_DEC(list);                                  \
+        }                                                                     \
+    } while (0)
+#define _ZEROLIST_BLOOM_REFILL(list)                    \
+    do {                                                \
+        if ((list)->bloom) _zerolist_bloom_fill(list); \
+    } while (0)
+#else
+#define _ZEROLIST_BLOOM_ADD(list, data) ((void)0)
+#define _ZEROLIST_BLOOM_DEL(list, data) ((void)0)
+#define _ZEROLIST_BLOOM_REFILL(list)    ((void)0)
+#endif
+
+#if ZEROLIST_UNIQUE_ENABLE
+// 动态模式下成员索引的初始桶数
+#define _ZEROLIST_INDEX_MIN_SLOTS 16
+
+// 数据指针所在的桶：取哈希高 32 位乘法映射到 [0, slots)，桶数无需为 2 的幂
+static inline size_t _zerolist_index_bucket(const void* data, size_t slots)
+{
+    return (size_t)(((_zerolist_ptr_hash(data) >> 32) * slots) >> 32);
+}
+
+// 动态模式下记录索引中的节点数，按它而不是 size 决定何时加倍桶数
+#if ZEROLIST_USE_MALLOC
+#define _ZEROLIST_INDEX_ITEMS_SET(list, n) ((list)->index_items = (n))
+#define _ZEROLIST_INDEX_ITEMS_INC(list)    ((list)->index_items++)
+#define _ZEROLIST_INDEX_ITEMS_DEC(list)    ((list)->index_items--)
+#else
+#define _ZEROLIST_INDEX_ITEMS_SET(list, n) ((void)0)
+#define _ZEROLIST_INDEX_ITEMS_INC(list)    ((void)0)
+#define _ZEROLIST_INDEX_ITEMS_DEC(list)    ((void)0)
+#endif
+
+static inline void _zerolist_index_add(Zerolist* list, zerolist_node_t* node)
+{
+    zerolist_node_t** b = &list->index[_zerolist_index_bucket(node->data, list->index_slots)];
+    node->hnext         = *b;
+    *b                  = node;
+    _ZEROLIST_INDEX_ITEMS_INC(list);
+}
+
+static inline void _zerolist_index_del(Zerolist* list, zerolist_node_t* node)
+{
+    zerolist_node_t** pp = &list->index[_zerolist_index_bucket(node->data, list->index_slots)];
+    while (*pp && *pp != node) pp = &(*pp)->hnext;
+    if (*pp) {
+        *pp = node->hnext;
+        _ZEROLIST_INDEX_ITEMS_DEC(list);
+    }
+}
+
+/*
+ * 在索引中查找数据为 data 的节点（最近链接的优先）；
+ * dup 非 NULL 时输出链表中是否还有其他数据相同的节点
+ */
+static zerolist_node_t* _zerolist_index_find(Zerolist* list, const void* data, bool* dup)
+{
+    zerolist_node_t* hit = NULL;
+    zerolist_node_t* cur = list->index[_zerolist_index_bucket(data, list->index_slots)];
+    for (; cur; cur = cur->hnext) {
+        if (cur->data != data) continue;
+        if (hit) {
+            *dup = true;
+            break;
+        }
+        hit = cur;
+        if (!dup) break;
+    }
+    return hit;
+}
+
+// 按链表当前内容重建索引；待回收环中的节点已不在链表中，不计入
+static void _zerolist_index_fill(Zerolist* list)
+{
+    memset(list->index, 0, list->index_slots * sizeof(zerolist_node_t*));
+    _ZEROLIST_INDEX_ITEMS_SET(list, 0);
+    if (!list->head) return;
+    zerolist_node_t* cur = list->head;
+    do {
+        _zerolist_index_add(list, cur);
+        cur = cur->next;
+    } while (cur != list->head);
+}
+
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+// 以 slots 个桶重新分配并重建索引；分配失败时保留原索引（仍然有效，只是桶链更长）
+static void _zerolist_index_resize(Zerolist* list, size_t slots)
+{
+    zerolist_node_t** index = (zerolist_node_t**)ZEROLIST_MALLOC(slots * sizeof(zerolist_node_t*));
+    if (!index) return;
+    if (list->index) ZEROLIST_FREE(list->index);
+    list->index       = index;
+    list->index_slots = slots;
+    _zerolist_index_fill(list);
+}
+#endif
+
+#define _ZEROLIST_INDEX_ADD(list, node)                    \
+    do {                                                   \
+        if ((list)->index) _zerolist_index_add(list, node); \
+    } while (0)
+#define _ZEROLIST_INDEX_DEL(list, node)                    \
+    do {                                                   \
+        if ((list)->index) _zerolist_index_del(list, node); \
+    } while (0)
+#define _ZEROLIST_INDEX_REFILL(list)                    \
+    do {                                                \
+        if ((list)->index) _zerolist_index_fill(list); \
+    } while (0)
+// 链表整体变空：所有桶置空
+#define _ZEROLIST_INDEX_CLEAR(list)                                                    \
+    do {                                                                               \
+        if ((list)->index) {                                                           \
+            memset((list)->index, 0, (list)->index_slots * sizeof(zerolist_node_t*)); \
+            _ZEROLIST_INDEX_ITEMS_SET(list, 0);                                        \
+        }                                                                              \
+    } while (0)
+#else
+#define _ZEROLIST_INDEX_ADD(list, node) ((void)0)
+#define _ZEROLIST_INDEX_DEL(list, node) ((void)0)
+#define _ZEROLIST_INDEX_REFILL(list)    ((void)0)
+#define _ZEROLIST_INDEX_CLEAR(list)     ((void)0)
+#endif
+
+#if ZEROLIST_ORDER_ENABLE
+/*
+ * 局部重标号（Dietz–Sleator）：x1 = base->next 为刚链接、尚无标签的节点。
+ * 沿 next 方向找最小的 j 使 label(xj) - label(base) > j²，把 x1..x(j-1) 均匀分布到
+ * 该区间；绕回 base 时区间为整个 32 位标签空间。
+ */
+static void _zerolist_order_relabel(zerolist_node_t* base)
+{
+    zerolist_node_t* end  = base->next;
+    uint64_t         j    = 1;
+    uint64_t         span = 0;
+    for (;;) {
+        end = end->next;
+        j++;
+        if (end == base) {
+            span = (uint64_t)1 << 32;
+            break;
+        }
+        span = (uint32_t)(end->label - base->label);
+        if (span > j * j) break;
+    }
+
+    uint64_t         step = span / j;
+    zerolist_node_t* cur  = base->next;
+    for (uint64_t k = 1; k < j; k++) {
+        cur->label = base->label + (uint32_t)(k * step);
+        cur        = cur->next;
+    }
+}
+
+// 为刚链接到 prev 与 next 之间的节点分配标签：取中点，间隙用尽时局部重标号
+static inline void _zerolist_order_assign(zerolist_node_t* node)
+{
+    zerolist_node_t* prev = node->prev;
+    if (prev == node) {
+        node->label = 0;
+        return;
+    }
+    // 只有两个节点时 prev == next，间隙为整个标签空间
+    uint64_t gap = node->next == prev ? (uint64_t)1 << 32
+                                      : (uint32_t)(node->next->label - prev->label);
+    if (gap >= 2) {
+        node->label = prev->label + (uint32_t)(gap >> 1);
+    } else {
+        _zerolist_order_relabel(prev);
+    }
+}
+
+// 批量重建后整体均匀分配标签
+static void _zerolist_order_relabel_all(Zerolist* list)
+{
+    if (!list->head) return;
+    uint64_t         n   = 0;
+    zerolist_node_t* cur = list->head;
+    do {
+        n++;
+        cur = cur->next;
+    } while (cur != list->head);
+
+    uint64_t step = ((uint64_t)1 << 32) / n;
+    for (uint64_t k = 0; k < n; k++) {
+        cur->label = (uint32_t)(k * step);
+        cur        = cur->next;
+    }
+}
+#define _ZEROLIST_ORDER_RELABEL(list) _zerolist_order_relabel_all(list)
+#else
+#define _ZEROLIST_ORDER_RELABEL(list) ((void)0)
+#endif
+
+// 初始化扩展功能的链表级状态
+#if ZEROLIST_DEFER_ENABLE
+#define _ZEROLIST_DEFER_INIT(list) memset(&(list)->pending, 0, sizeof((list)->pending))
+#else
+#define _ZEROLIST_DEFER_INIT(list) ((void)0)
+#endif
+
+#define _ZEROLIST_EXT_INIT(list)     \
+    do {                             \
+        _ZEROLIST_AGG_INIT(list);    \
+        _ZEROLIST_SEARCH_INIT(list); \
+        _ZEROLIST_KEY_INIT(list);    \
+        _ZEROLIST_DEFER_INIT(list);  \
+    } while (0)
+
+/*
+ * 动态模式：过滤器 / 索引中的元素超出容量时翻倍重建（按各自的元素计数，不依赖 size）
+ */
+static inline void _zerolist_ext_grow(Zerolist* list)
+{
+#if ZEROLIST_BLOOM_ENABLE && ZEROLIST_USE_MALLOC
+    if (list->bloom && list->bloom_items * ZEROLIST_BLOOM_RATIO > list->bloom_slots) {
+        _zerolist_bloom_resize(list, list->bloom_items << 1);
+    }
+#endif
+#if ZEROLIST_UNIQUE_ENABLE && ZEROLIST_USE_MALLOC
+    if (list->index && list->index_items > list->index_slots) {
+        _zerolist_index_resize(list, list->index_slots << 1);
+    }
+#endif
+    (void)list;
+}
+
+/*
+ * 节点数据进入链表后的钩子：node 已链接到最终位置（head 已更新）
+ */
+static inline void _zerolist_on_link(Zerolist* list, zerolist_node_t* node)
+{
+    _ZEROLIST_KEY_SET(list, node);
+#if ZEROLIST_ORDER_ENABLE
+    _zerolist_order_assign(node);
+#endif
+    _ZEROLIST_BLOOM_ADD(list, node->data);
+    _ZEROLIST_INDEX_ADD(list, node);
+    _zerolist_ext_grow(list);
+#if ZEROLIST_AGGREGATE_ENABLE
+    const zerolist_monoid_t* m = list->monoid;
+    if (m && !list->agg_stale) {
+        ZEROLIST_AGG_TYPE v = m->extract(node->data);
+        if (!_ZEROLIST_AGG_TWO_STACK(m)) {
+            list->agg = node == list->head ? m->combine(v, list->agg) : m->combine(list->agg, v);
+        } else if (node == list->head) {
+            // 压入前段：后缀汇总接在原表头之前
+            zerolist_node_t* next = _ZEROLIST_NEXT(list, node);
+            node->agg             = list->agg_front ? m->combine(v, next->agg) : v;
+            list->agg_front++;
+        } else if (node == _ZEROLIST_PREV(list, list->head)) {
+            list->agg = m->combine(list->agg, v);
+        } else if (m->commutative) {
+            // 中间插入：整体并入后段
+            list->agg       = m->combine(_zerolist_agg_total(list), v);
+            list->agg_front = 0;
+        } else {
+            list->agg_stale = 1;
+        }
+    }
+#else
+    (void)list;
+    (void)node;
+#endif
+}
+
+/*
+ * 节点数据离开链表前的钩子：node 仍链接在链表中
+ */
+static inline void _zerolist_on_unlink(Zerolist* list, zerolist_node_t* node)
+{
+    _ZEROLIST_BLOOM_DEL(list, node->data);
+    _ZEROLIST_INDEX_DEL(list, node);
+#if ZEROLIST_AGGREGATE_ENABLE
+    const zerolist_monoid_t* m = list->monoid;
+    if (m) {
+        if (node->next == node) {
+            list->agg       = m->identity;
+            list->agg_front = 0;
+            list->agg_stale = 0;
+        } else if (!list->agg_stale) {
+            if (!_ZEROLIST_AGG_TWO_STACK(m)) {
+                list->agg = m->uncombine(list->agg, m->extract(node->data));
+            } else if (node == list->head && list->agg_front) {
+                // 弹出前段栈顶：下一个节点的后缀汇总即为剩余前段
+                list->agg_front--;
+            } else {
+                list->agg_stale = 1;
+            }
+        }
+    }
+#else
+    (void)list;
+    (void)node;
+#endif
+}
+
 #if !ZEROLIST_USE_MALLOC
 
 /*
@@ -118,6 +719,7 @@ static inline ZEROLIST_TYPE _zerolist_calc_node_index(Zerolist* list, zerolist_n
         if ((list)->free_top > 0) {                          \
             (idx)  = (list)->free_stack[--(list)->free_top]; \
             (node) = &(list)->node_buf[(idx)];               \
+            _ZEROLIST_DIRTY_STACK_POP(list);                 \
         }                                                    \
     } while (0)
 
@@ -277,6 +879,7 @@ void zerolist_free_node(Zerolist* list, zerolist_node_t* node)
 #else
     ZEROLIST_TYPE idx = _zerolist_calc_node_index(list, node);
     _ZEROLIST_FREE_STATIC_NODE(list, node, idx);
+    _ZEROLIST_DIRTY_MARK(list, node);
 #endif
 #endif
 }
@@ -293,9 +896,23 @@ void zerolist_free_node(Zerolist* list, zerolist_node_t* node)
 bool list_init_dynamic(Zerolist* list)
 {
     if (!list) return false;
+#if ZEROLIST_VIEW_ENABLE
+    // 修改计数跨初始化保留并递增，使之前创建的视图失效
+    uint32_t mod_count = list->mod_count;
+#endif
     memset(list, 0, sizeof(Zerolist));
+#if ZEROLIST_VIEW_ENABLE
+    list->mod_count = mod_count + 1;
+#endif
 #if ZEROLIST_SIZE_ENABLE
     list->size = 0;
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    // 过滤器分配失败不影响链表本身，只是失去快速否定
+    _zerolist_bloom_resize(list, _ZEROLIST_BLOOM_MIN_NODES);
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    _zerolist_index_resize(list, _ZEROLIST_INDEX_MIN_SLOTS);
 #endif
     return true;
 }
@@ -308,12 +925,21 @@ bool list_init_dynamic(Zerolist* list)
 
 void zerolist_destroy(Zerolist* list)
 {
-    if (!list) return;
-    zerolist_clear(list);
+    while (zerolist_destroy_step(list, (ZEROLIST_TYPE)-1)) {
+    }
+}
 
-#if ZEROLIST_USE_MALLOC
+bool zerolist_destroy_step(Zerolist* list, ZEROLIST_TYPE budget)
+{
+    if (!list) return false;
 
-#elif ZEROLIST_STATIC_DYNAMIC_EXPAND
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+    // 节点全部位于库管理的缓冲区中，整体释放即可，无需逐个回收
+    (void)budget;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_AGG_EMPTY(list);
+    list->head    = NULL;
+    list->reclaim = NULL;
     if (list->node_buf) {
         ZEROLIST_FREE(list->node_buf);
         list->node_buf = NULL;
@@ -323,22 +949,57 @@ void zerolist_destroy(Zerolist* list)
         ZEROLIST_FREE(list->free_stack);
         list->free_stack = NULL;
     }
+#endif
+#if ZEROLIST_DIRTY_TRACK
+    if (list->dirty_bits) {
+        ZEROLIST_FREE(list->dirty_bits);
+        list->dirty_bits = NULL;
+    }
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    if (list->bloom) {
+        ZEROLIST_FREE(list->bloom);
+        list->bloom       = NULL;
+        list->bloom_slots = 0;
+    }
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    if (list->index) {
+        ZEROLIST_FREE(list->index);
+        list->index       = NULL;
+        list->index_slots = 0;
+    }
 #endif
     list->max_nodes = 0;
-    list->head      = NULL;
 
 #if ZEROLIST_SIZE_ENABLE
     list->size = 0;
 #endif
+    return false;
 #else
+    if (zerolist_clear_step(list, budget)) return true;
+#if ZEROLIST_USE_MALLOC && ZEROLIST_BLOOM_ENABLE
+    if (list->bloom) {
+        ZEROLIST_FREE(list->bloom);
+        list->bloom       = NULL;
+        list->bloom_slots = 0;
+    }
+#endif
+#if ZEROLIST_USE_MALLOC && ZEROLIST_UNIQUE_ENABLE
+    if (list->index) {
+        ZEROLIST_FREE(list->index);
+        list->index       = NULL;
+        list->index_slots = 0;
+    }
+#endif
+#if !ZEROLIST_USE_MALLOC && ZEROLIST_FAST_ALLOC
     // 纯静态模式：缓冲区由用户管理，不需要释放内存
     // max_nodes 保持不变，以便 zerolist_reinit 可以重新使用
-    // 注意：head、tail、size 已在 zerolist_clear 中重置
-#if ZEROLIST_FAST_ALLOC
     if (list->free_stack) {
         list->free_top = 0;
     }
 #endif
+    return false;
 #endif
 }
 
@@ -376,7 +1037,14 @@ bool zerolist_reinit(Zerolist* list, ZEROLIST_TYPE initial_size)
     // max_nodes 在 destroy 时不会被设置为 0，所以这里可以正常使用
     if (!list->node_buf || list->max_nodes == 0) return false;
 
-    list->head = NULL;
+    list->head    = NULL;
+    list->reclaim = NULL;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_EXT_INIT(list);
+#if ZEROLIST_BLOOM_ENABLE
+    if (list->bloom) memset(list->bloom, 0, list->bloom_slots);
+#endif
+    _ZEROLIST_INDEX_CLEAR(list);
 
 #if ZEROLIST_SIZE_ENABLE
     list->size = 0;
@@ -396,6 +1064,12 @@ bool zerolist_reinit(Zerolist* list, ZEROLIST_TYPE initial_size)
         list->node_buf[i].flags.in_use = 0;
         list->node_buf[i].flags.index  = i;
     }
+#endif
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(list);
+#if ZEROLIST_FAST_ALLOC
+    list->dirty_free_low = 0;
+#endif
 #endif
     return true;
 #endif
@@ -417,10 +1091,49 @@ void zerolist_init_expand(Zerolist* list, zerolist_node_t* buf,
                           ZEROLIST_TYPE* free_stack,
 #endif
                           ZEROLIST_TYPE max_nodes)
+{
+    zerolist_init_expand_ex(list, buf,
+#if ZEROLIST_FAST_ALLOC
+                            free_stack,
+#endif
+                            max_nodes, NULL);
+}
+
+void zerolist_init_expand_ex(Zerolist* list, zerolist_node_t* buf,
+#if ZEROLIST_FAST_ALLOC
+                             ZEROLIST_TYPE* free_stack,
+#endif
+                             ZEROLIST_TYPE max_nodes, const zerolist_ext_storage_t* ext)
 {
     if (!list || !buf || max_nodes == 0) return;
 
-    list->head = NULL;
+    // 扩展存储只从 ext 获取，不读取 *list 中可能未初始化的指针
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+    ext = NULL;
+#endif
+#if ZEROLIST_DIRTY_TRACK
+    list->dirty_bits = ext ? ext->dirty_bits : NULL;
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    list->bloom       = ext && ext->bloom_slots ? ext->bloom : NULL;
+    list->bloom_slots = list->bloom ? ext->bloom_slots : 0;
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    list->index       = ext && ext->index_slots ? ext->index : NULL;
+    list->index_slots = list->index ? ext->index_slots : 0;
+#endif
+#if !(ZEROLIST_DIRTY_TRACK || ZEROLIST_BLOOM_ENABLE || ZEROLIST_UNIQUE_ENABLE)
+    (void)ext;
+#endif
+
+    list->head    = NULL;
+    list->reclaim = NULL;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_EXT_INIT(list);
+#if ZEROLIST_BLOOM_ENABLE
+    if (list->bloom) memset(list->bloom, 0, list->bloom_slots);
+#endif
+    _ZEROLIST_INDEX_CLEAR(list);
 
     list->node_buf  = buf;
     list->max_nodes = max_nodes;
@@ -443,6 +1156,13 @@ void zerolist_init_expand(Zerolist* list, zerolist_node_t* buf,
         buf[i].flags.index  = i;
     }
 #endif
+
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(list);
+#if ZEROLIST_FAST_ALLOC
+    list->dirty_free_low = 0;
+#endif
+#endif
 }
 
 #if ZEROLIST_STATIC_DYNAMIC_EXPAND
@@ -476,32 +1196,41 @@ static void _zerolist_update_node_pointers(Zerolist* list, zerolist_node_t* old_
     }
 
     list->node_buf = new_buf;
+    _ZEROLIST_MODIFIED(list);
 
-    if (new_buf == old_buf || !list->head) {
+    if (new_buf == old_buf) {
         return;
     }
 
-    ZEROLIST_TYPE head_idx = (ZEROLIST_TYPE)(list->head - old_buf);
-    list->head             = &new_buf[head_idx];
+    // 链表本身与待回收环（见 zerolist_clear_step）都需要重定位
+    zerolist_node_t** rings[2] = { &list->head, &list->reclaim };
+    for (int r = 0; r < 2; r++) {
+        if (!*rings[r]) continue;
 
-    zerolist_node_t* cur = list->head;
-    do {
-        ZEROLIST_TYPE current_idx = (ZEROLIST_TYPE)(cur - new_buf);
-        ZEROLIST_TYPE prev_idx    = (ZEROLIST_TYPE)(cur->prev - old_buf);
-        ZEROLIST_TYPE next_idx    = (ZEROLIST_TYPE)(cur->next - old_buf);
+        ZEROLIST_TYPE head_idx = (ZEROLIST_TYPE)(*rings[r] - old_buf);
+        *rings[r]              = &new_buf[head_idx];
 
-        if (prev_idx >= new_size || prev_idx < 0) {
-            prev_idx = current_idx;
-        }
-        if (next_idx >= new_size || next_idx < 0) {
-            next_idx = current_idx;
-        }
+        zerolist_node_t* cur = *rings[r];
+        do {
+            ZEROLIST_TYPE current_idx = (ZEROLIST_TYPE)(cur - new_buf);
+            ZEROLIST_TYPE prev_idx    = (ZEROLIST_TYPE)(cur->prev - old_buf);
+            ZEROLIST_TYPE next_idx    = (ZEROLIST_TYPE)(cur->next - old_buf);
+
+            if (prev_idx >= new_size || prev_idx < 0) {
+                prev_idx = current_idx;
+            }
+            if (next_idx >= new_size || next_idx < 0) {
+                next_idx = current_idx;
+            }
 
-        cur->prev = &new_buf[prev_idx];
-        cur->next = &new_buf[next_idx];
+            cur->prev = &new_buf[prev_idx];
+            cur->next = &new_buf[next_idx];
 
-        cur = cur->next;
-    } while (cur != list->head);
+            cur = cur->next;
+        } while (cur != *rings[r]);
+    }
+    // 成员索引保存的是节点地址，随缓冲区一起重建
+    _ZEROLIST_INDEX_REFILL(list);
 }
 
 /*
@@ -529,7 +1258,7 @@ static bool _zerolist_rollback_realloc(Zerolist* list, zerolist_node_t* new_buf,
         return false;
     }
 
-    if (rollback_buf != new_buf && list->head) {
+    if (rollback_buf != new_buf && (list->head || list->reclaim)) {
         _zerolist_update_node_pointers(list, new_buf, rollback_buf, new_size, old_size);
     }
 
@@ -548,6 +1277,14 @@ static bool _zerolist_expand_buffer(Zerolist* list, ZEROLIST_TYPE new_size)
 {
     if (new_size <= list->max_nodes) return false;
 
+#if ZEROLIST_DIRTY_TRACK
+    // 先扩展位图：失败时节点缓冲区尚未改动，无需回滚
+    uint8_t* new_bits =
+        (uint8_t*)ZEROLIST_REALLOC(list->dirty_bits, ZEROLIST_DIRTY_BYTES(new_size));
+    if (!new_bits) return false;
+    list->dirty_bits = new_bits;
+#endif
+
     zerolist_node_t* old_buf  = list->node_buf;
     ZEROLIST_TYPE    old_size = list->max_nodes;
 
@@ -585,6 +1322,18 @@ static bool _zerolist_expand_buffer(Zerolist* list, ZEROLIST_TYPE new_size)
 #endif
 
     list->max_nodes = new_size;
+#if ZEROLIST_DIRTY_TRACK
+    for (ZEROLIST_TYPE i = old_size; i < new_size; i++) {
+        _ZEROLIST_DIRTY_MARK(list, &list->node_buf[i]);
+    }
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    // 过滤器按新容量重建，保持假阳性率稳定
+    _zerolist_bloom_resize(list, new_size);
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    _zerolist_index_resize(list, new_size);
+#endif
     return true;
 }
 bool zerolist_shrink_buffer(Zerolist* list, ZEROLIST_TYPE new_size)
@@ -630,6 +1379,12 @@ bool zerolist_shrink_buffer(Zerolist* list, ZEROLIST_TYPE new_size)
 #endif
 
     list->max_nodes = new_size;
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(list);
+#if ZEROLIST_FAST_ALLOC
+    list->dirty_free_low = 0;
+#endif
+#endif
     return true;
 }
 
@@ -652,7 +1407,28 @@ bool list_init_dynamic_expand(Zerolist* list, ZEROLIST_TYPE initial_size)
     ZEROLIST_TYPE* free_stack = NULL;
 #endif
 
-    list->head = NULL;
+#if ZEROLIST_DIRTY_TRACK
+    uint8_t* dirty_bits = (uint8_t*)ZEROLIST_MALLOC(ZEROLIST_DIRTY_BYTES(initial_size));
+    if (!dirty_bits) {
+        ZEROLIST_FREE(buf);
+        if (free_stack) ZEROLIST_FREE(free_stack);
+        return false;
+    }
+    list->dirty_bits = dirty_bits;
+#endif
+
+    list->head    = NULL;
+    list->reclaim = NULL;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_EXT_INIT(list);
+#if ZEROLIST_BLOOM_ENABLE
+    list->bloom       = NULL;
+    list->bloom_slots = 0;
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    list->index       = NULL;
+    list->index_slots = 0;
+#endif
 
     list->node_buf  = buf;
     list->max_nodes = initial_size;
@@ -675,6 +1451,18 @@ bool list_init_dynamic_expand(Zerolist* list, ZEROLIST_TYPE initial_size)
     }
 #endif
 
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(list);
+#if ZEROLIST_FAST_ALLOC
+    list->dirty_free_low = 0;
+#endif
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    _zerolist_bloom_resize(list, initial_size);
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    _zerolist_index_resize(list, initial_size);
+#endif
     return true;
 }
 #endif  // ZEROLIST_STATIC_DYNAMIC_EXPAND
@@ -685,56 +1473,80 @@ bool list_init_dynamic_expand(Zerolist* list, ZEROLIST_TYPE initial_size)
 //  插入操作
 // ===========================================
 
-static inline bool _zerolist_insert_internal(Zerolist* list, zerolist_node_t* pos, void* data,
-                                             bool before)
+/*
+ * 把已初始化数据的游离节点链接到 pos 之前/之后（逻辑方向），pos 为 NULL 时按 before 取表头/表尾
+ */
+static inline void _zerolist_link_node(Zerolist* list, zerolist_node_t* node, zerolist_node_t* pos,
+                                       bool before)
 {
-#if ZEROLIST_STATIC_DYNAMIC_EXPAND && !ZEROLIST_USE_MALLOC
-    ZEROLIST_TYPE pos_idx       = 0;
-    bool          pos_idx_valid = false;
-    if (pos && _zerolist_is_static_node(list, pos)) {
-        pos_idx       = (ZEROLIST_TYPE)(pos - list->node_buf);
-        pos_idx_valid = true;
-    }
-#endif
-
-    zerolist_node_t* node = _zerolist_alloc_node(list);
-    if (!node) return false;
-    node->data = data;
-
-#if ZEROLIST_STATIC_DYNAMIC_EXPAND && !ZEROLIST_USE_MALLOC
-    if (pos && pos_idx_valid && !_zerolist_is_static_node(list, pos)) {
-        pos = &list->node_buf[pos_idx];
-    }
-#endif
+    _ZEROLIST_MODIFIED(list);
 
     if (!list->head) {
         list->head = node;
         node->next = node->prev = node;
+        _ZEROLIST_DIRTY_MARK(list, node);
 #if ZEROLIST_SIZE_ENABLE
         list->size = 1;
 #endif
-        return true;
+        _zerolist_on_link(list, node);
+        return;
     }
 
-    if (!pos) pos = before ? list->head : list->head->prev;
+    if (!pos) pos = before ? list->head : _ZEROLIST_PREV(list, list->head);
 
-    if (before) {
+#if ZEROLIST_LAZY_REVERSE
+    // 反转状态下逻辑上的“之前”即物理上的“之后”
+    bool phys_before = before != (bool)list->reversed;
+#else
+    bool phys_before = before;
+#endif
+    if (phys_before) {
         node->prev      = pos->prev;
         node->next      = pos;
         pos->prev->next = node;
         pos->prev       = node;
-        if (pos == list->head) {
-            list->head = node;
-        }
     } else {
         node->next      = pos->next;
         node->prev      = pos;
         pos->next->prev = node;
         pos->next       = node;
     }
+    if (before && pos == list->head) {
+        list->head = node;
+    }
+    _ZEROLIST_DIRTY_MARK(list, node);
+    _ZEROLIST_DIRTY_MARK(list, node->prev);
+    _ZEROLIST_DIRTY_MARK(list, node->next);
 #if ZEROLIST_SIZE_ENABLE
     list->size++;
 #endif
+    _zerolist_on_link(list, node);
+}
+
+static inline bool _zerolist_insert_internal(Zerolist* list, zerolist_node_t* pos, void* data,
+                                             bool before)
+{
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND && !ZEROLIST_USE_MALLOC
+    ZEROLIST_TYPE pos_idx       = 0;
+    bool          pos_idx_valid = false;
+    if (pos && _zerolist_is_static_node(list, pos)) {
+        pos_idx       = (ZEROLIST_TYPE)(pos - list->node_buf);
+        pos_idx_valid = true;
+    }
+#endif
+
+    zerolist_node_t* node = _zerolist_alloc_node(list);
+    if (!node) return false;
+    node->data = data;
+    _ZEROLIST_EXTRA_RESET(node);
+
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND && !ZEROLIST_USE_MALLOC
+    if (pos && pos_idx_valid && !_zerolist_is_static_node(list, pos)) {
+        pos = &list->node_buf[pos_idx];
+    }
+#endif
+
+    _zerolist_link_node(list, node, pos, before);
     return true;
 }
 
@@ -750,13 +1562,60 @@ bool zerolist_push_back(Zerolist* list, void* data)
     return _zerolist_insert_internal(list, NULL, data, false);
 }
 
+#if !ZEROLIST_USE_MALLOC
+// 静态节点池是否已无空闲节点（不考虑扩容与回退）
+static inline bool _zerolist_pool_full(Zerolist* list)
+{
+#if ZEROLIST_FAST_ALLOC
+    return list->free_top == 0;
+#else
+    return zerolist_size(list) >= list->max_nodes;
+#endif
+}
+#endif
+
+/*
+ * 把头节点原地改写为携带 data 的尾节点：头指针前进一步，不改链接也不经过节点池
+ */
+static void _zerolist_recycle_head(Zerolist* list, void* data, void** evicted)
+{
+    zerolist_node_t* node = list->head;
+
+    _ZEROLIST_MODIFIED(list);
+    _zerolist_on_unlink(list, node);
+    if (evicted) *evicted = node->data;
+    node->data = data;
+    _ZEROLIST_EXTRA_RESET(node);
+    _ZEROLIST_DIRTY_MARK(list, node);
+    list->head = _ZEROLIST_NEXT(list, node);
+    _zerolist_on_link(list, node);
+}
+
+bool zerolist_push_back_evict(Zerolist* list, void* data, void** evicted)
+{
+    if (evicted) *evicted = NULL;
+    if (!list) return false;
+
+#if !ZEROLIST_USE_MALLOC
+    if (list->head && _zerolist_pool_full(list)) {
+        _zerolist_recycle_head(list, data, evicted);
+        return true;
+    }
+#endif
+    if (_zerolist_insert_internal(list, NULL, data, false)) return true;
+    // 分配失败（如节点仍在分步回收中）时同样淘汰最旧的数据
+    if (!list->head) return false;
+    _zerolist_recycle_head(list, data, evicted);
+    return true;
+}
+
 bool zerolist_insert_before(Zerolist* list, void* target_data, void* new_data)
 {
     if (!list || !list->head) return false;
     zerolist_node_t* cur = list->head;
     do {
         if (cur->data == target_data) return _zerolist_insert_internal(list, cur, new_data, true);
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
     } while (cur != list->head);
     return false;
 }
@@ -780,19 +1639,329 @@ static inline void _zerolist_detach_node(Zerolist* list, zerolist_node_t* cur)
 {
     if (!list || !cur) return;
 
+    _ZEROLIST_MODIFIED(list);
+    _zerolist_on_unlink(list, cur);
+    _ZEROLIST_DIRTY_MARK(list, cur);
     if (cur->next == cur) {
         list->head = NULL;
         return;
     }
+    _ZEROLIST_DIRTY_MARK(list, cur->prev);
+    _ZEROLIST_DIRTY_MARK(list, cur->next);
 
     if (cur == list->head) {
-        list->head = cur->next;
+        list->head = _ZEROLIST_NEXT(list, cur);
     }
 
     cur->prev->next = cur->next;
     cur->next->prev = cur->prev;
 }
 
+/*
+ * 把在链表中的 node 移到 pos 之前（逻辑方向），只改链接，不经过释放/分配
+ */
+static inline void _zerolist_move_before(Zerolist* list, zerolist_node_t* node,
+                                         zerolist_node_t* pos)
+{
+    if (node == pos) return;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_AGG_REORDER(list);
+
+    zerolist_node_t* before = _ZEROLIST_PREV(list, pos);
+    if (before != node) {
+        if (node == list->head) list->head = _ZEROLIST_NEXT(list, node);
+        _ZEROLIST_DIRTY_MARK(list, node->prev);
+        _ZEROLIST_DIRTY_MARK(list, node->next);
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        _ZEROLIST_LINK(list, before, node);
+        _ZEROLIST_LINK(list, node, pos);
+#if ZEROLIST_ORDER_ENABLE
+        _zerolist_order_assign(node);
+#endif
+        _ZEROLIST_DIRTY_MARK(list, before);
+        _ZEROLIST_DIRTY_MARK(list, node);
+        _ZEROLIST_DIRTY_MARK(list, pos);
+    }
+    // node 已紧邻 pos 之前（如两节点环）时只需更新头指针
+    if (pos == list->head) list->head = node;
+}
+
+/*
+ * 把在链表中的 node 移到队尾（逻辑方向）
+ */
+static inline void _zerolist_move_to_back(Zerolist* list, zerolist_node_t* node)
+{
+    zerolist_node_t* head = list->head;
+    if (node == _ZEROLIST_PREV(list, head)) return;
+    if (node == head) {
+        // 头节点移到队尾即整个环前进一步，无需改动链接
+        _ZEROLIST_MODIFIED(list);
+        _ZEROLIST_AGG_REORDER(list);
+        list->head = _ZEROLIST_NEXT(list, head);
+    } else {
+        _zerolist_move_before(list, node, head);
+        list->head = head;
+    }
+}
+
+// ===========================================
+//  有序合并
+// ===========================================
+
+/*
+ * 把 from 中的 node 移到 to 中 pos 之前（pos 为 NULL 时追加到表尾）
+ *
+ * 纯动态模式直接重新链接节点；静态模式在 to 的节点池中分配新节点承载数据后释放原节点，
+ * 分配失败时两条链表都保持不变。
+ */
+static bool _zerolist_transfer(Zerolist* to, Zerolist* from, zerolist_node_t* node,
+                               zerolist_node_t* pos)
+{
+#if !ZEROLIST_USE_MALLOC
+    if (!_zerolist_insert_internal(to, pos, node->data, pos != NULL)) return false;
+#endif
+    _zerolist_detach_node(from, node);
+#if ZEROLIST_SIZE_ENABLE
+    from->size--;
+#endif
+#if ZEROLIST_USE_MALLOC
+    _zerolist_link_node(to, node, pos, pos != NULL);
+#else
+    zerolist_free_node(from, node);
+#endif
+    return true;
+}
+
+bool zerolist_merge(Zerolist* dst, Zerolist* src, int (*cmp)(const void* a, const void* b))
+{
+    if (!dst || !src || !cmp || dst == src) return false;
+
+    // cur：dst 中第一个大于 src 当前元素的节点，NULL 表示已越过 dst 表尾
+    zerolist_node_t* cur = dst->head;
+    while (src->head) {
+        void* data = src->head->data;
+        while (cur && cmp(cur->data, data) <= 0) {
+            cur = _ZEROLIST_NEXT(dst, cur);
+            if (cur == dst->head) cur = NULL;
+        }
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+        ZEROLIST_TYPE cur_idx = cur ? (ZEROLIST_TYPE)(cur - dst->node_buf) : 0;
+#endif
+        if (!_zerolist_transfer(dst, src, src->head, cur)) return false;
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+        if (cur) cur = &dst->node_buf[cur_idx];
+#endif
+    }
+    return true;
+}
+
+// k 路合并堆的比较：先比数据，相等时下标小的链表优先（保证稳定）
+static inline bool _zerolist_merge_less(Zerolist* const* lists, uint32_t a, uint32_t b,
+                                        int (*cmp)(const void*, const void*))
+{
+    int c = cmp(lists[a]->head->data, lists[b]->head->data);
+    return c < 0 || (c == 0 && a < b);
+}
+
+static void _zerolist_merge_sift_down(Zerolist* const* lists, uint32_t* heap, size_t n, size_t i,
+                                      int (*cmp)(const void*, const void*))
+{
+    for (;;) {
+        size_t min = i;
+        size_t l   = 2 * i + 1;
+        size_t r   = l + 1;
+        if (l < n && _zerolist_merge_less(lists, heap[l], heap[min], cmp)) min = l;
+        if (r < n && _zerolist_merge_less(lists, heap[r], heap[min], cmp)) min = r;
+        if (min == i) return;
+        uint32_t tmp = heap[i];
+        heap[i]      = heap[min];
+        heap[min]    = tmp;
+        i            = min;
+    }
+}
+
+bool zerolist_merge_k(Zerolist* out, Zerolist* const* lists, size_t k,
+                      int (*cmp)(const void* a, const void* b))
+{
+    if (!out || !lists || !cmp || k > ZEROLIST_MERGE_K_MAX) return false;
+
+    uint32_t heap[ZEROLIST_MERGE_K_MAX];
+    size_t   n = 0;
+    for (size_t i = 0; i < k; i++) {
+        if (lists[i] == out) return false;
+        // 同一链表出现两次会让两个堆元素共用一条链表，取空后另一个仍会解引用空表头
+        for (size_t j = 0; j < i; j++) {
+            if (lists[i] && lists[j] == lists[i]) return false;
+        }
+        if (lists[i] && lists[i]->head) heap[n++] = (uint32_t)i;
+    }
+    for (size_t i = n / 2; i-- > 0;) {
+        _zerolist_merge_sift_down(lists, heap, n, i, cmp);
+    }
+
+    while (n > 0) {
+        Zerolist* from = lists[heap[0]];
+        if (!_zerolist_transfer(out, from, from->head, NULL)) return false;
+        if (!from->head) heap[0] = heap[--n];
+        _zerolist_merge_sift_down(lists, heap, n, 0, cmp);
+    }
+    return true;
+}
+
+// ===========================================
+//  去重与划分
+// ===========================================
+
+// 逻辑方向上的前向/后向指针字段（ZEROLIST_LAZY_REVERSE 反转时对调）
+static inline zerolist_node_t** _zerolist_fwd(zerolist_node_t* node, bool rev)
+{
+    return rev ? &node->prev : &node->next;
+}
+
+static inline zerolist_node_t** _zerolist_bwd(zerolist_node_t* node, bool rev)
+{
+    return rev ? &node->next : &node->prev;
+}
+
+size_t zerolist_unique(Zerolist* list, uint32_t (*hash)(const void* data),
+                       bool (*eq)(const void* a, const void* b))
+{
+    if (!list || !list->head) return 0;
+
+    // 临时哈希集合：桶数组只存链头，冲突链借用已保留节点的后向指针，结束时再整体重建
+    zerolist_node_t*  stack_buckets[ZEROLIST_DEDUP_STACK_BUCKETS];
+    zerolist_node_t** buckets = stack_buckets;
+    size_t            slots   = ZEROLIST_DEDUP_STACK_BUCKETS;
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+    size_t want = slots;
+    while (want < (size_t)zerolist_size(list)) {
+        want <<= 1;
+    }
+    if (want > slots) {
+        zerolist_node_t** big = (zerolist_node_t**)ZEROLIST_MALLOC(want * sizeof(*big));
+        if (big) {
+            buckets = big;
+            slots   = want;
+        }
+    }
+#endif
+    memset(buckets, 0, slots * sizeof(*buckets));
+
+#if ZEROLIST_LAZY_REVERSE
+    bool rev = list->reversed;
+#else
+    bool rev = false;
+#endif
+    _ZEROLIST_MODIFIED(list);
+
+    // 在逻辑表尾处断开环，逐个决定保留或删除；保留的节点沿前向指针串成新序列
+    zerolist_node_t* kept_head = NULL;
+    zerolist_node_t* kept_tail = NULL;
+    size_t           removed   = 0;
+    zerolist_node_t* node      = list->head;
+    *_zerolist_fwd(_ZEROLIST_PREV(list, node), rev) = NULL;
+    while (node) {
+        zerolist_node_t*  next = *_zerolist_fwd(node, rev);
+        uint32_t          h    = hash ? hash(node->data)
+                                      : (uint32_t)(_zerolist_ptr_hash(node->data) >> 32);
+        zerolist_node_t** slot = &buckets[h & (slots - 1)];
+        zerolist_node_t*  hit  = *slot;
+        while (hit && !(eq ? eq(hit->data, node->data) : hit->data == node->data)) {
+            hit = *_zerolist_bwd(hit, rev);
+        }
+        if (hit) {
+            _zerolist_on_unlink(list, node);
+            zerolist_free_node(list, node);
+            removed++;
+        } else {
+            *_zerolist_bwd(node, rev) = *slot;
+            *slot                     = node;
+            if (kept_tail) {
+                *_zerolist_fwd(kept_tail, rev) = node;
+            } else {
+                kept_head = node;
+            }
+            kept_tail = node;
+        }
+        node = next;
+    }
+
+    // 重建后向指针并闭合成环（第一个节点一定被保留）
+    *_zerolist_fwd(kept_tail, rev) = kept_head;
+
+    zerolist_node_t* prev = kept_tail;
+    node                  = kept_head;
+    do {
+        *_zerolist_bwd(node, rev) = prev;
+        _ZEROLIST_DIRTY_MARK(list, node);
+        prev = node;
+        node = *_zerolist_fwd(node, rev);
+    } while (node != kept_head);
+    list->head = kept_head;
+#if ZEROLIST_SIZE_ENABLE
+    list->size = (ZEROLIST_TYPE)(list->size - removed);
+#endif
+
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND
+    if (buckets != stack_buckets) ZEROLIST_FREE(buckets);
+#endif
+    return removed;
+}
+
+bool zerolist_partition(Zerolist* list, bool (*pred)(const void* data, void* ctx), void* ctx,
+                        Zerolist* out, size_t* moved)
+{
+    if (moved) *moved = 0;
+    if (!list || !pred || !out || list == out) return false;
+    if (!list->head) return true;
+
+    size_t           count = 0;
+    bool             ok    = true;
+    zerolist_node_t* node  = list->head;
+    zerolist_node_t* last  = _ZEROLIST_PREV(list, node);
+    for (;;) {
+        bool             done = node == last;
+        zerolist_node_t* next = _ZEROLIST_NEXT(list, node);
+        if (pred(node->data, ctx)) {
+            if (!_zerolist_transfer(out, list, node, NULL)) {
+                ok = false;
+                break;
+            }
+            count++;
+        }
+        if (done) break;
+        node = next;
+    }
+    if (moved) *moved = count;
+    return ok;
+}
+
+size_t zerolist_stable_partition(Zerolist* list, bool (*pred)(const void* data, void* ctx),
+                                 void* ctx)
+{
+    if (!list || !pred || !list->head) return 0;
+
+    // 满足条件的节点依次移到第一个不满足条件的节点之前，两组内部都保持原顺序
+    size_t           hits        = 0;
+    zerolist_node_t* first_false = NULL;
+    zerolist_node_t* node        = list->head;
+    zerolist_node_t* last        = _ZEROLIST_PREV(list, node);
+    for (;;) {
+        bool             done = node == last;
+        zerolist_node_t* next = _ZEROLIST_NEXT(list, node);
+        if (pred(node->data, ctx)) {
+            hits++;
+            if (first_false) _zerolist_move_before(list, node, first_false);
+        } else if (!first_false) {
+            first_false = node;
+        }
+        if (done) break;
+        node = next;
+    }
+    return hits;
+}
+
 void* zerolist_pop_front(Zerolist* list)
 {
     if (!list || !list->head) return NULL;
@@ -813,7 +1982,7 @@ void* zerolist_pop_back(Zerolist* list)
 {
     if (!list || !list->head) return NULL;
 
-    zerolist_node_t* node = list->head->prev;
+    zerolist_node_t* node = _ZEROLIST_PREV(list, list->head);
     void*            data = node->data;
 
 #if ZEROLIST_SIZE_ENABLE
@@ -837,7 +2006,7 @@ void* zerolist_pop_at(Zerolist* list, ZEROLIST_TYPE index)
 
     zerolist_node_t* cur = list->head;
     for (ZEROLIST_TYPE i = 0; i < index; ++i) {
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (cur == list->head) return NULL;
     }
 
@@ -855,6 +2024,25 @@ void* zerolist_pop_at(Zerolist* list, ZEROLIST_TYPE index)
 bool zerolist_remove_ptr(Zerolist* list, void* data)
 {
     if (!list || !data || !list->head) return false;
+#if ZEROLIST_BLOOM_ENABLE
+    if (!zerolist_may_contain(list, data)) return false;
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    if (list->index) {
+        bool             dup = false;
+        zerolist_node_t* hit = _zerolist_index_find(list, data, &dup);
+        if (!hit) return false;
+        // 同一指针出现多次时应删除链表顺序上的第一个，交给下面的扫描
+        if (!dup) {
+            _zerolist_detach_node(list, hit);
+            zerolist_free_node(list, hit);
+#if ZEROLIST_SIZE_ENABLE
+            list->size--;
+#endif
+            return true;
+        }
+    }
+#endif
 
 #if ZEROLIST_SIZE_ENABLE
     zerolist_node_t* cur       = list->head;
@@ -868,7 +2056,7 @@ bool zerolist_remove_ptr(Zerolist* list, void* data)
 #endif
             return true;
         }
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
     }
 #else
@@ -885,7 +2073,7 @@ bool zerolist_remove_ptr(Zerolist* list, void* data)
 #endif
             return true;
         }
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
         if (++count > ZEROLIST_SAFETY_LIMIT) break;
     } while (cur != start);
@@ -910,7 +2098,7 @@ bool zerolist_remove_if(Zerolist* list, void* data, bool (*cmp_func)(const void*
 #endif
             return true;
         }
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
     }
 #else
@@ -927,7 +2115,7 @@ bool zerolist_remove_if(Zerolist* list, void* data, bool (*cmp_func)(const void*
 #endif
             return true;
         }
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
         if (++count > ZEROLIST_SAFETY_LIMIT) break;
     } while (cur != start);
@@ -946,7 +2134,7 @@ bool zerolist_remove_at(Zerolist* list, ZEROLIST_TYPE index)
 #endif
     zerolist_node_t* cur = list->head;
     for (ZEROLIST_TYPE i = 0; i < index; ++i) {
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (cur == list->head) return false;
     }
     _zerolist_detach_node(list, cur);
@@ -958,66 +2146,292 @@ bool zerolist_remove_at(Zerolist* list, ZEROLIST_TYPE index)
 }
 
 // ===========================================
-//  查询 / 遍历
+//  区间删除 / 区间移动
 // ===========================================
 
-void* zerolist_at(Zerolist* list, ZEROLIST_TYPE index)
+// 定位索引 index 处的节点，有 size 计数时从较近的一端出发
+static zerolist_node_t* _zerolist_node_at(Zerolist* list, ZEROLIST_TYPE index)
 {
-    if (!list || !list->head) return NULL;
+    if (!list->head) return NULL;
 #if ZEROLIST_SIZE_ENABLE
     if (index >= list->size) return NULL;
-    zerolist_node_t* cur = list->head;
-    for (ZEROLIST_TYPE i = 0; i < index; ++i) {
-        cur = cur->next;
-        if (!cur) return NULL;
+    if (index > (ZEROLIST_TYPE)(list->size >> 1)) {
+        zerolist_node_t* cur = _ZEROLIST_PREV(list, list->head);
+        for (ZEROLIST_TYPE i = (ZEROLIST_TYPE)(list->size - 1); i > index; --i) {
+            cur = _ZEROLIST_PREV(list, cur);
+        }
+        return cur;
     }
-    return cur->data;
-#else
+#endif
     zerolist_node_t* cur = list->head;
-    if (index > ZEROLIST_SAFETY_LIMIT) return NULL;
     for (ZEROLIST_TYPE i = 0; i < index; ++i) {
-        cur = cur->next;
-        if (!cur) return NULL;
+        cur = _ZEROLIST_NEXT(list, cur);
+        if (cur == list->head) return NULL;
     }
-    return cur->data;
-#endif
+    return cur;
 }
 
-#define _ZEROLIST_FOREACH_NODE_STATIC(list, node_var, body)        \
-    do {                                                           \
-        for (ZEROLIST_TYPE _i = 0; _i < (list)->max_nodes; ++_i) { \
-            zerolist_node_t* node_var = &(list)->node_buf[_i];     \
-            if (_ZEROLIST_NODE_IS_IN_USE(node_var)) {              \
-                body                                               \
-            }                                                      \
-        }                                                          \
-    } while (0)
+/*
+ * 从 first 开始摘下一段连续节点：最多 limit 个，遇到 last（包含）或链表末尾即停止。
+ * 每个节点或释放（out == NULL），或移入 out；整段只在结束时修补一次链接。
+ *
+ * 返回实际处理的节点数
+ */
+static ZEROLIST_TYPE _zerolist_take_run(Zerolist* list, zerolist_node_t* first,
+                                        zerolist_node_t* last, ZEROLIST_TYPE limit, Zerolist* out)
+{
+    zerolist_node_t* head   = list->head;
+    zerolist_node_t* tail   = _ZEROLIST_PREV(list, head);
+    zerolist_node_t* before = first == head ? NULL : _ZEROLIST_PREV(list, first);
+    zerolist_node_t* after  = NULL;
+    zerolist_node_t* cur    = first;
+    ZEROLIST_TYPE    count  = 0;
 
-#define _ZEROLIST_FOREACH_NODE_DYNAMIC(list, node_var, body) \
-    do {                                                     \
-        if ((list)->head) {                                  \
-            zerolist_node_t* _start   = (list)->head;        \
-            zerolist_node_t* node_var = _start;              \
-            do {                                             \
-                body node_var = node_var->next;              \
-                if (!node_var) break;                        \
-            } while (node_var != _start);                    \
-        }                                                    \
+    _ZEROLIST_MODIFIED(list);
+
+#if ZEROLIST_USE_MALLOC
+    zerolist_node_t* out_tail = out && out->head ? _ZEROLIST_PREV(out, out->head) : NULL;
+#endif
+
+    while (count < limit) {
+        zerolist_node_t* next   = _ZEROLIST_NEXT(list, cur);
+        bool             at_end = cur == last || next == head;
+
+        if (out) {
+#if ZEROLIST_USE_MALLOC
+            // 动态模式：节点直接改挂到 out 尾部
+            _zerolist_on_unlink(list, cur);
+            _ZEROLIST_KEY_SET(out, cur);
+            _ZEROLIST_BLOOM_ADD(out, cur->data);
+            _ZEROLIST_INDEX_ADD(out, cur);
+            if (!out_tail) {
+                out->head = cur;
+            } else {
+                _ZEROLIST_LINK(out, out_tail, cur);
+            }
+            out_tail = cur;
+#else
+            // 静态模式：节点池不共享，复制数据指针后释放本节点
+            if (!_zerolist_insert_internal(out, NULL, cur->data, false)) {
+                after = cur;
+                break;
+            }
+            _ZEROLIST_EXTRA_COPY(_ZEROLIST_PREV(out, out->head), cur);
+            _zerolist_on_unlink(list, cur);
+            zerolist_free_node(list, cur);
+#endif
+        } else {
+            _zerolist_on_unlink(list, cur);
+            zerolist_free_node(list, cur);
+        }
+        count++;
+
+        if (at_end) {
+            after = next == head ? NULL : next;
+            break;
+        }
+        cur = next;
+        after = cur;
+    }
+
+#if ZEROLIST_USE_MALLOC
+    if (out && out_tail) {
+        _ZEROLIST_LINK(out, out_tail, out->head);
+        _zerolist_ext_grow(out);
+        _ZEROLIST_AGG_STALE(out);
+        _ZEROLIST_ORDER_RELABEL(out);
+#if ZEROLIST_SIZE_ENABLE
+        out->size += count;
+#endif
+    }
+#endif
+
+    if (count == 0) return 0;
+
+    // 一次性修补剩余链表
+    if (!before && !after) {
+        list->head = NULL;
+    } else if (!before) {
+        list->head = after;
+        _ZEROLIST_LINK(list, tail, after);
+        _ZEROLIST_DIRTY_MARK(list, tail);
+        _ZEROLIST_DIRTY_MARK(list, after);
+    } else {
+        zerolist_node_t* succ = after ? after : head;
+        _ZEROLIST_LINK(list, before, succ);
+        _ZEROLIST_DIRTY_MARK(list, before);
+        _ZEROLIST_DIRTY_MARK(list, succ);
+    }
+#if ZEROLIST_SIZE_ENABLE
+    list->size -= count;
+#endif
+    return count;
+}
+
+ZEROLIST_TYPE zerolist_erase_range(Zerolist* list, ZEROLIST_TYPE first, ZEROLIST_TYPE last)
+{
+    if (!list || first >= last) return 0;
+    zerolist_node_t* node = _zerolist_node_at(list, first);
+    if (!node) return 0;
+    return _zerolist_take_run(list, node, NULL, (ZEROLIST_TYPE)(last - first), NULL);
+}
+
+ZEROLIST_TYPE zerolist_erase_nodes(Zerolist* list, zerolist_node_t* first, zerolist_node_t* last)
+{
+    if (!list || !first || !list->head) return 0;
+    return _zerolist_take_run(list, first, last, (ZEROLIST_TYPE)-1, NULL);
+}
+
+ZEROLIST_TYPE zerolist_extract_range(Zerolist* list, ZEROLIST_TYPE first, ZEROLIST_TYPE last,
+                                     Zerolist* out_list)
+{
+    if (!list || !out_list || list == out_list || first >= last) return 0;
+    zerolist_node_t* node = _zerolist_node_at(list, first);
+    if (!node) return 0;
+    return _zerolist_take_run(list, node, NULL, (ZEROLIST_TYPE)(last - first), out_list);
+}
+
+ZEROLIST_TYPE zerolist_extract_nodes(Zerolist* list, zerolist_node_t* first, zerolist_node_t* last,
+                                     Zerolist* out_list)
+{
+    if (!list || !out_list || list == out_list || !first || !list->head) return 0;
+    return _zerolist_take_run(list, first, last, (ZEROLIST_TYPE)-1, out_list);
+}
+
+// ===========================================
+//  查询 / 遍历
+// ===========================================
+
+void* zerolist_at(Zerolist* list, ZEROLIST_TYPE index)
+{
+    if (!list || !list->head) return NULL;
+#if ZEROLIST_SIZE_ENABLE
+    if (index >= list->size) return NULL;
+    zerolist_node_t* cur = list->head;
+    for (ZEROLIST_TYPE i = 0; i < index; ++i) {
+        cur = _ZEROLIST_NEXT(list, cur);
+        if (!cur) return NULL;
+    }
+    return cur->data;
+#else
+    zerolist_node_t* cur = list->head;
+    if (index > ZEROLIST_SAFETY_LIMIT) return NULL;
+    for (ZEROLIST_TYPE i = 0; i < index; ++i) {
+        cur = _ZEROLIST_NEXT(list, cur);
+        if (!cur) return NULL;
+    }
+    return cur->data;
+#endif
+}
+
+#define _ZEROLIST_FOREACH_NODE_STATIC(list, node_var, body)        \
+    do {                                                           \
+        for (ZEROLIST_TYPE _i = 0; _i < (list)->max_nodes; ++_i) { \
+            zerolist_node_t* node_var = &(list)->node_buf[_i];     \
+            if (_ZEROLIST_NODE_IS_IN_USE(node_var)) {              \
+                body                                               \
+            }                                                      \
+        }                                                          \
+    } while (0)
+
+#define _ZEROLIST_FOREACH_NODE_DYNAMIC(list, node_var, body)  \
+    do {                                                      \
+        if ((list)->head) {                                   \
+            zerolist_node_t* _start   = (list)->head;         \
+            zerolist_node_t* node_var = _start;               \
+            do {                                              \
+                body node_var = _ZEROLIST_NEXT(list, node_var); \
+                if (!node_var) break;                         \
+            } while (node_var != _start);                     \
+        }                                                     \
     } while (0)
 
+#if ZEROLIST_SELF_ORGANIZE
+// 按策略调整命中节点的位置
+static void _zerolist_search_promote(Zerolist* list, zerolist_node_t* node)
+{
+    switch (list->search_policy) {
+    case ZEROLIST_SEARCH_MOVE_TO_FRONT:
+        _zerolist_move_before(list, node, list->head);
+        break;
+    case ZEROLIST_SEARCH_TRANSPOSE:
+        if (node != list->head) _zerolist_move_before(list, node, _ZEROLIST_PREV(list, node));
+        break;
+    case ZEROLIST_SEARCH_COUNT: {
+        if (node->hits != UINT32_MAX) node->hits++;
+        zerolist_node_t* pos = node;
+        while (pos != list->head) {
+            zerolist_node_t* prev = _ZEROLIST_PREV(list, pos);
+            if (prev->hits >= node->hits) break;
+            pos = prev;
+        }
+        _zerolist_move_before(list, node, pos);
+        break;
+    }
+    default: break;
+    }
+}
+
+// 从头按链表顺序查找（cmp 为 NULL 时按地址比较），统计探测深度并调整命中节点
+static zerolist_node_t* _zerolist_search_organize(Zerolist* list, const void* target,
+                                                  bool (*cmp)(const void*, const void*))
+{
+    list->search_stats.searches++;
+    if (!list->head) return NULL;
+
+    zerolist_node_t* cur   = list->head;
+    uint32_t         depth = 0;
+    do {
+        depth++;
+        if (cmp ? cmp(cur->data, target) : cur->data == target) {
+            list->search_stats.found++;
+            list->search_stats.probes += depth;
+            _zerolist_search_promote(list, cur);
+            return cur;
+        }
+        cur = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head);
+    list->search_stats.probes += depth;
+    return NULL;
+}
+#endif
+
 zerolist_node_t* zerolist_find(Zerolist* list, const void* target_addr)
 {
     if (!list) return NULL;
+#if ZEROLIST_BLOOM_ENABLE
+    if (!zerolist_may_contain(list, target_addr)) return NULL;
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    if (list->index) {
+        zerolist_node_t* hit = _zerolist_index_find(list, target_addr, NULL);
+#if ZEROLIST_SELF_ORGANIZE
+        // 启用调整策略时命中仍按链表顺序查找，以便统计探测深度并调整位置
+        if (!hit || list->search_policy == ZEROLIST_SEARCH_NONE) return hit;
+#else
+        return hit;
+#endif
+    }
+#endif
+
+#if ZEROLIST_SELF_ORGANIZE
+    if (list->search_policy != ZEROLIST_SEARCH_NONE) {
+        return _zerolist_search_organize(list, target_addr, NULL);
+    }
+#endif
 
 #if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC
-    _ZEROLIST_FOREACH_NODE_STATIC(list, node, {
-        if (node->data == target_addr) return node;
-    });
-#else
+    // 待回收节点仍标记为在用，此时只能按链表遍历
+    if (!list->reclaim) {
+        _ZEROLIST_FOREACH_NODE_STATIC(list, node, {
+            if (node->data == target_addr) return node;
+        });
+        return NULL;
+    }
+#endif
     _ZEROLIST_FOREACH_NODE_DYNAMIC(list, node, {
         if (node->data == target_addr) return node;
     });
-#endif
     return NULL;
 }
 
@@ -1026,12 +2440,15 @@ zerolist_node_t* zerolist_search(Zerolist* list, const void* target_data,
 {
     if (!list || !cmp_func || !list->head) return NULL;
 
+#if ZEROLIST_SELF_ORGANIZE
+    return _zerolist_search_organize(list, target_data, cmp_func);
+#endif
 #if ZEROLIST_SIZE_ENABLE
     zerolist_node_t* cur       = list->head;
     ZEROLIST_TYPE    remaining = list->size;
     while (remaining--) {
         if (cmp_func(cur->data, target_data)) return cur;
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
     }
 #else
@@ -1041,7 +2458,7 @@ zerolist_node_t* zerolist_search(Zerolist* list, const void* target_data,
 
     do {
         if (cmp_func(cur->data, target_data)) return cur;
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) break;
         if (++count > ZEROLIST_SAFETY_LIMIT) break;
     } while (cur != start);
@@ -1057,7 +2474,7 @@ void zerolist_foreach(Zerolist* list, void (*callback)(void* data))
     ZEROLIST_TYPE    remaining = list->size;
     while (remaining--) {
         callback(cur->data);
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (!cur) return;
     }
 #else
@@ -1067,7 +2484,7 @@ void zerolist_foreach(Zerolist* list, void (*callback)(void* data))
     do {
         if (!cur) return;
         callback(cur->data);
-        cur = cur->next;
+        cur = _ZEROLIST_NEXT(list, cur);
         if (++count > ZEROLIST_SAFETY_LIMIT) {
             break;
         }
@@ -1075,6 +2492,68 @@ void zerolist_foreach(Zerolist* list, void (*callback)(void* data))
 #endif
 }
 
+// 把 32 位随机数映射到 [0, n)（乘法取高位，避免取模）
+static inline uint32_t _zerolist_rand_below(uint32_t (*rng)(void*), void* ctx, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)rng(ctx) * n) >> 32);
+}
+
+zerolist_node_t* zerolist_random(Zerolist* list, uint32_t (*rng)(void* ctx), void* ctx)
+{
+    if (!list || !rng || !list->head) return NULL;
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC
+    // 待回收节点仍带 in_use 标记，此时探测结果不再等概率
+    if (!list->reclaim) {
+#if ZEROLIST_SIZE_ENABLE
+        // 装载率低于 1/ZEROLIST_RANDOM_PROBES 时探测大概率落空，直接遍历
+        bool dense = (uint32_t)list->size * ZEROLIST_RANDOM_PROBES >= list->max_nodes;
+#else
+        bool dense = true;
+#endif
+        for (int i = 0; dense && i < ZEROLIST_RANDOM_PROBES; i++) {
+            uint32_t         idx  = _zerolist_rand_below(rng, ctx, list->max_nodes);
+            zerolist_node_t* node = &list->node_buf[idx];
+            if (node->flags.in_use) return node;
+        }
+    }
+#endif
+
+#if ZEROLIST_SIZE_ENABLE
+    return _zerolist_node_at(list, (ZEROLIST_TYPE)_zerolist_rand_below(rng, ctx, list->size));
+#else
+    // 长度未知：单元素蓄水池抽样
+    zerolist_node_t* pick = list->head;
+    zerolist_node_t* cur  = _ZEROLIST_NEXT(list, list->head);
+    for (uint32_t seen = 2; cur != list->head; seen++) {
+        if (_zerolist_rand_below(rng, ctx, seen) == 0) pick = cur;
+        cur = _ZEROLIST_NEXT(list, cur);
+    }
+    return pick;
+#endif
+}
+
+ZEROLIST_TYPE zerolist_sample(Zerolist* list, ZEROLIST_TYPE k, void** out,
+                              uint32_t (*rng)(void* ctx), void* ctx)
+{
+    if (!list || !out || !rng || k == 0 || !list->head) return 0;
+
+    ZEROLIST_TYPE    n    = 0;
+    uint32_t         seen = 0;
+    zerolist_node_t* cur  = list->head;
+    do {
+        seen++;
+        if (n < k) {
+            out[n++] = cur->data;
+        } else {
+            uint32_t j = _zerolist_rand_below(rng, ctx, seen);
+            if (j < k) out[j] = cur->data;
+        }
+        cur = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head);
+    return n;
+}
+
 // ===========================================
 // 工具函数
 // ===========================================
@@ -1084,6 +2563,15 @@ void zerolist_reverse(Zerolist* list)
     if (!list || !list->head) return;
 
     if (list->head->next == list->head) return;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_AGG_REORDER(list);
+
+#if ZEROLIST_LAZY_REVERSE
+    // O(1)：只翻转方向标志，原尾节点成为新的头节点
+    list->head     = _ZEROLIST_PREV(list, list->head);
+    list->reversed = !list->reversed;
+    return;
+#endif
 
     zerolist_node_t* cur      = list->head;
     zerolist_node_t* old_tail = list->head->prev;
@@ -1092,51 +2580,2181 @@ void zerolist_reverse(Zerolist* list)
         zerolist_node_t* tmp = cur->next;
         cur->next            = cur->prev;
         cur->prev            = tmp;
-        cur                  = tmp;
+#if ZEROLIST_ORDER_ENABLE
+        // 取反后标签沿新的 next 方向递增，间隙不变
+        cur->label = 0u - cur->label;
+#endif
+        _ZEROLIST_DIRTY_MARK(list, cur);
+        cur = tmp;
     } while (cur != list->head);
 
     list->head = old_tail;
 }
-void zerolist_clear(Zerolist* list)
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC
+// 把从 src_buf 拷贝而来的节点指针重定位到 dst_buf
+#define _ZEROLIST_REBASE(ptr, src_buf, dst_buf) \
+    ((zerolist_node_t*)((uintptr_t)(dst_buf) + ((uintptr_t)(ptr) - (uintptr_t)(src_buf))))
+#endif
+
+bool zerolist_clone(Zerolist* dst, const Zerolist* src)
 {
-    if (!list) return;
+    if (!dst || !src || dst == src) return false;
 
 #if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_FALLBACK_MALLOC
+    if (!src->node_buf || !dst->node_buf) return false;
+    if (dst->max_nodes < src->max_nodes) {
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+        if (!_zerolist_expand_buffer(dst, src->max_nodes)) return false;
+#else
+        return false;
+#endif
+    }
 
-    for (ZEROLIST_TYPE i = 0; i < list->max_nodes; ++i) {
-        zerolist_node_t* node = &list->node_buf[i];
-        _ZEROLIST_NODE_SET_FREE(node);
-        node->next = node->prev = node;
-        node->data              = NULL;
+    zerolist_node_t* sbuf = src->node_buf;
+    zerolist_node_t* dbuf = dst->node_buf;
+    memcpy(dbuf, sbuf, (size_t)src->max_nodes * _ZEROLIST_NODE_SIZE);
+
+    // 线性重定位：只改写在用节点的链接，空闲节点统一指向自身
+    for (ZEROLIST_TYPE i = 0; i < src->max_nodes; i++) {
+        zerolist_node_t* node = &dbuf[i];
+        if (node->flags.in_use) {
+            node->prev = _ZEROLIST_REBASE(node->prev, sbuf, dbuf);
+            node->next = _ZEROLIST_REBASE(node->next, sbuf, dbuf);
+        } else {
+            node->prev = node->next = node;
+        }
     }
-#else
-    zerolist_node_t* cur = list->head;
-    while (cur) {
-        zerolist_node_t* next = cur->next;
-        zerolist_free_node(list, cur);
-        cur = next == list->head ? NULL : next;
+    for (ZEROLIST_TYPE i = src->max_nodes; i < dst->max_nodes; i++) {
+        dbuf[i].flags.in_use = 0;
+        dbuf[i].flags.index  = i;
+        dbuf[i].data         = NULL;
+        dbuf[i].prev = dbuf[i].next = &dbuf[i];
+    }
+
+#if ZEROLIST_FAST_ALLOC
+    memcpy(dst->free_stack, src->free_stack, (size_t)src->free_top * sizeof(ZEROLIST_TYPE));
+    dst->free_top = src->free_top;
+    for (ZEROLIST_TYPE i = dst->max_nodes; i > src->max_nodes; i--) {
+        dst->free_stack[dst->free_top++] = (ZEROLIST_TYPE)(i - 1);
     }
 #endif
 
-    list->head = NULL;
+    // src 中等待回收的节点不属于链表，在 dst 中直接归还
+    dst->reclaim = NULL;
+    if (src->reclaim) {
+        zerolist_node_t* cur = src->reclaim;
+        do {
+            zerolist_node_t* next = cur->next;
+            zerolist_node_t* node = _ZEROLIST_REBASE(cur, sbuf, dbuf);
+            node->flags.in_use    = 0;
+            node->data            = NULL;
+            node->prev = node->next = node;
+#if ZEROLIST_FAST_ALLOC
+            dst->free_stack[dst->free_top++] = (ZEROLIST_TYPE)(node - dbuf);
+#endif
+            cur = next;
+        } while (cur != src->reclaim);
+    }
+
+    dst->head = src->head ? _ZEROLIST_REBASE(src->head, sbuf, dbuf) : NULL;
 #if ZEROLIST_SIZE_ENABLE
-    list->size = 0;
+    dst->size = src->size;
+#endif
+#if ZEROLIST_LAZY_REVERSE
+    dst->reversed = src->reversed;
+#endif
+    _ZEROLIST_MODIFIED(dst);
+    _ZEROLIST_AGG_STALE(dst);
+    _ZEROLIST_BLOOM_REFILL(dst);
+    _ZEROLIST_INDEX_REFILL(dst);
+    _ZEROLIST_KEY_REFILL(dst);
+    _ZEROLIST_ORDER_RELABEL(dst);
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(dst);
+#if ZEROLIST_FAST_ALLOC
+    dst->dirty_free_low = 0;
+#endif
+#endif
+    return true;
+#else
+    zerolist_clear(dst);
+    if (!src->head) return true;
+
+    // 批量路径：一次遍历分配并串接，最后再闭合成环，避免逐个插入的分支开销
+    zerolist_node_t* first = NULL;
+    zerolist_node_t* last  = NULL;
+    ZEROLIST_TYPE    count = 0;
+    zerolist_node_t* cur   = src->head;
+    do {
+        zerolist_node_t* node = _zerolist_alloc_node(dst);
+        if (!node) {
+            while (first) {
+                zerolist_node_t* next = first == last ? NULL : first->next;
+                zerolist_free_node(dst, first);
+                first = next;
+            }
+            return false;
+        }
+        node->data = cur->data;
+        _ZEROLIST_EXTRA_COPY(node, cur);
+        if (!first) {
+            first = node;
+        } else {
+            last->next = node;
+            node->prev = last;
+        }
+        last = node;
+        count++;
+        cur = _ZEROLIST_NEXT(src, cur);
+    } while (cur != src->head);
+
+    last->next  = first;
+    first->prev = last;
+    dst->head   = first;
+    _ZEROLIST_MODIFIED(dst);
+    _ZEROLIST_AGG_STALE(dst);
+    _ZEROLIST_BLOOM_REFILL(dst);
+    _ZEROLIST_INDEX_REFILL(dst);
+    _ZEROLIST_KEY_REFILL(dst);
+    _ZEROLIST_ORDER_RELABEL(dst);
+#if ZEROLIST_LAZY_REVERSE
+    dst->reversed = 0;
+#endif
+#if ZEROLIST_SIZE_ENABLE
+    dst->size = count;
+#else
+    (void)count;
+#endif
+    return true;
 #endif
 }
 
-ZEROLIST_TYPE zerolist_size(Zerolist* list)
+// 沿 prev（rev=true）或 next 方向前进一步；rev 为常量时分支在内联后消除
+#define _ZEROLIST_STEP(node, rev) ((rev) ? (node)->prev : (node)->next)
+
+static inline ZEROLIST_TYPE _zerolist_gather(zerolist_node_t* head, void** out, ZEROLIST_TYPE n,
+                                             const bool rev)
 {
+    zerolist_node_t* node = head;
+    ZEROLIST_TYPE    i    = 0;
 #if ZEROLIST_SIZE_ENABLE
-    return list ? list->size : 0;
+    // n 不超过链表长度，无需逐个判断回绕
+    for (; i + 4 <= n; i += 4) {
+        zerolist_node_t* n1 = _ZEROLIST_STEP(node, rev);
+        zerolist_node_t* n2 = _ZEROLIST_STEP(n1, rev);
+        zerolist_node_t* n3 = _ZEROLIST_STEP(n2, rev);
+        _ZEROLIST_PREFETCH(_ZEROLIST_STEP(n3, rev), 0);
+        out[i]     = node->data;
+        out[i + 1] = n1->data;
+        out[i + 2] = n2->data;
+        out[i + 3] = n3->data;
+        node       = _ZEROLIST_STEP(n3, rev);
+    }
+    for (; i < n; i++) {
+        out[i] = node->data;
+        node   = _ZEROLIST_STEP(node, rev);
+    }
 #else
-    ZEROLIST_TYPE cnt = 0;
-    if (!list || !list->head) return 0;
-    zerolist_node_t* cur = list->head;
     do {
-        cnt++;
-        cur = cur->next;
-        if (cnt > ZEROLIST_SAFETY_LIMIT) break;
-    } while (cur != list->head);
-    return cnt;
+        zerolist_node_t* next = _ZEROLIST_STEP(node, rev);
+        _ZEROLIST_PREFETCH(next, 0);
+        out[i++] = node->data;
+        node     = next;
+    } while (i < n && node != head);
+#endif
+    return i;
+}
+
+ZEROLIST_TYPE zerolist_to_array(Zerolist* list, void** out, ZEROLIST_TYPE cap)
+{
+    if (!list || !out || !list->head || cap == 0) return 0;
+
+#if ZEROLIST_SIZE_ENABLE
+    ZEROLIST_TYPE n = list->size < cap ? list->size : cap;
+#else
+    ZEROLIST_TYPE n = cap;
+#endif
+#if ZEROLIST_LAZY_REVERSE
+    if (list->reversed) return _zerolist_gather(list->head, out, n, true);
+#endif
+    return _zerolist_gather(list->head, out, n, false);
+}
+
+#if !ZEROLIST_USE_MALLOC
+// 把 buf[i] 标记为承载 value 的在用节点（链接由调用方设置）
+#define _ZEROLIST_SEAT(buf, i, value)       \
+    do {                                    \
+        zerolist_node_t* _n = &(buf)[(i)];  \
+        _n->data            = (value);      \
+        _ZEROLIST_EXTRA_RESET(_n);          \
+        _ZEROLIST_NODE_SET_IN_USE(_n, (i)); \
+    } while (0)
+
+// 铺设 buf[i] 并链接在 buf[i-1] 之后（i >= 1）
+#define _ZEROLIST_SEAT_AFTER(buf, i, value)    \
+    do {                                       \
+        _ZEROLIST_SEAT(buf, i, value);         \
+        (buf)[(i)].prev     = &(buf)[(i) - 1]; \
+        (buf)[(i) - 1].next = &(buf)[(i)];     \
+    } while (0)
+#endif
+
+bool zerolist_from_array(Zerolist* list, void* const* arr, ZEROLIST_TYPE count)
+{
+    if (!list || (!arr && count)) return false;
+
+#if !ZEROLIST_USE_MALLOC
+    if (!list->node_buf) return false;
+#if !ZEROLIST_STATIC_DYNAMIC_EXPAND && !ZEROLIST_STATIC_FALLBACK_MALLOC
+    if (count > list->max_nodes) return false;
+#endif
+#endif
+
+    zerolist_clear(list);
+    if (count == 0) return true;
+
+    zerolist_node_t* first = NULL;
+    zerolist_node_t* last  = NULL;
+    ZEROLIST_TYPE    i     = 0;
+
+#if !ZEROLIST_USE_MALLOC
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+    if (count > list->max_nodes && !_zerolist_expand_buffer(list, count)) return false;
+#endif
+    // 清空后所有槽位空闲：顺序铺设在 node_buf 前部，逻辑顺序即物理顺序
+    zerolist_node_t* buf = list->node_buf;
+    ZEROLIST_TYPE    n   = count < list->max_nodes ? count : list->max_nodes;
+    if (n > 0) {
+        // 首尾节点的外侧链接在最后闭合成环时设置，这里不构造越界指针
+        _ZEROLIST_SEAT(buf, 0, arr[0]);
+        for (i = 1; i + 4 <= n; i += 4) {
+            if (i + 16 < count) _ZEROLIST_PREFETCH(&arr[i + 16], 0);
+            if (i + 8 < n) _ZEROLIST_PREFETCH(&buf[i + 8], 1);
+            _ZEROLIST_SEAT_AFTER(buf, i, arr[i]);
+            _ZEROLIST_SEAT_AFTER(buf, i + 1, arr[i + 1]);
+            _ZEROLIST_SEAT_AFTER(buf, i + 2, arr[i + 2]);
+            _ZEROLIST_SEAT_AFTER(buf, i + 3, arr[i + 3]);
+        }
+        for (; i < n; i++) {
+            _ZEROLIST_SEAT_AFTER(buf, i, arr[i]);
+        }
+        first = &buf[0];
+        last  = &buf[n - 1];
+    }
+#if ZEROLIST_FAST_ALLOC
+    // 空闲栈按降序重建，栈顶为 n，后续插入继续顺序使用槽位
+    list->free_top = 0;
+    for (ZEROLIST_TYPE j = list->max_nodes; j > n; j--) {
+        list->free_stack[list->free_top++] = (ZEROLIST_TYPE)(j - 1);
+    }
+#endif
+#if ZEROLIST_DIRTY_TRACK
+    _ZEROLIST_DIRTY_MARK_ALL(list);
+#if ZEROLIST_FAST_ALLOC
+    list->dirty_free_low = 0;
+#endif
+#endif
+#endif
+
+    // 剩余部分（动态模式 / 静态池外的回退节点）逐个分配后直接串接
+    for (; i < count; i++) {
+        zerolist_node_t* node = _zerolist_alloc_node(list);
+        if (!node) {
+            if (first) {
+                last->next  = first;
+                first->prev = last;
+                list->head  = first;
+#if ZEROLIST_SIZE_ENABLE
+                list->size = i;
 #endif
+            }
+            zerolist_clear(list);
+            return false;
+        }
+        node->data = arr[i];
+        _ZEROLIST_EXTRA_RESET(node);
+        if (!first) {
+            first = node;
+        } else {
+            last->next = node;
+            node->prev = last;
+        }
+        last = node;
+    }
+
+    last->next  = first;
+    first->prev = last;
+    list->head  = first;
+    _ZEROLIST_MODIFIED(list);
+    _ZEROLIST_AGG_STALE(list);
+    _ZEROLIST_BLOOM_REFILL(list);
+    _ZEROLIST_INDEX_REFILL(list);
+    _ZEROLIST_KEY_REFILL(list);
+    _ZEROLIST_ORDER_RELABEL(list);
+#if ZEROLIST_LAZY_REVERSE
+    list->reversed = 0;
+#endif
+#if ZEROLIST_SIZE_ENABLE
+    list->size = count;
+#endif
+    return true;
+}
+
+bool zerolist_clear_step(Zerolist* list, ZEROLIST_TYPE budget)
+{
+    if (!list) return false;
+
+    // 摘链：把当前链表整体并入待回收环，链表立即变为空
+    if (list->head) {
+        zerolist_node_t* head = list->head;
+        _ZEROLIST_MODIFIED(list);
+        _ZEROLIST_AGG_EMPTY(list);
+        _ZEROLIST_INDEX_CLEAR(list);
+        if (!list->reclaim) {
+            list->reclaim = head;
+        } else {
+            zerolist_node_t* a_tail = list->reclaim->prev;
+            zerolist_node_t* b_tail = head->prev;
+            a_tail->next            = head;
+            head->prev              = a_tail;
+            b_tail->next            = list->reclaim;
+            list->reclaim->prev     = b_tail;
+            _ZEROLIST_DIRTY_MARK(list, a_tail);
+            _ZEROLIST_DIRTY_MARK(list, b_tail);
+            _ZEROLIST_DIRTY_MARK(list, head);
+            _ZEROLIST_DIRTY_MARK(list, list->reclaim);
+        }
+        list->head = NULL;
+#if ZEROLIST_SIZE_ENABLE
+        list->size = 0;
+#endif
+#if ZEROLIST_LAZY_REVERSE
+        list->reversed = 0;
+#endif
+    }
+
+    // 回收：从环头开始释放至多 budget 个节点，最后一次性修补环
+    zerolist_node_t* cur = list->reclaim;
+    if (!cur) return false;
+    zerolist_node_t* tail = cur->prev;
+    while (budget--) {
+        zerolist_node_t* next = cur->next;
+        bool             last = cur == tail;
+        _ZEROLIST_BLOOM_DEL(list, cur->data);
+        zerolist_free_node(list, cur);
+        if (last) {
+            list->reclaim = NULL;
+            return false;
+        }
+        cur = next;
+    }
+    cur->prev     = tail;
+    tail->next    = cur;
+    list->reclaim = cur;
+    _ZEROLIST_DIRTY_MARK(list, cur);
+    _ZEROLIST_DIRTY_MARK(list, tail);
+    return true;
+}
+
+void zerolist_clear(Zerolist* list)
+{
+    while (zerolist_clear_step(list, (ZEROLIST_TYPE)-1)) {
+    }
+}
+
+ZEROLIST_TYPE zerolist_size(Zerolist* list)
+{
+#if ZEROLIST_SIZE_ENABLE
+    return list ? list->size : 0;
+#else
+    ZEROLIST_TYPE cnt = 0;
+    if (!list || !list->head) return 0;
+    zerolist_node_t* cur = list->head;
+    do {
+        cnt++;
+        cur = cur->next;
+        if (cnt > ZEROLIST_SAFETY_LIMIT) break;
+    } while (cur != list->head);
+    return cnt;
+#endif
+}
+
+#if ZEROLIST_SHM_ENABLE
+// ===========================================
+// 跨进程共享内存链表
+// ===========================================
+
+#define _ZEROLIST_SHM_MAGIC 0x5A4C5348u  // "ZLSH"
+#define _ZEROLIST_SHM_ALIGN 16u
+#define _ZEROLIST_SHM_ROUND(n) \
+    (((n) + (_ZEROLIST_SHM_ALIGN - 1)) & ~((size_t)_ZEROLIST_SHM_ALIGN - 1))
+
+/*
+ * 共享区域中的节点：只保存下标，不保存任何进程相关的绝对地址。
+ * 节点 i 的负载固定位于 payload 区的第 i 个槽位。
+ */
+typedef struct
+{
+    ZEROLIST_TYPE prev;
+    ZEROLIST_TYPE next;
+    uint8_t       in_use;  // 槽位已被预留（可能尚未链接）
+    uint8_t       linked;  // 槽位已链接到队列中
+} _zerolist_shm_node_t;
+
+/*
+ * 区域布局：[region 头][节点数组][空闲栈][负载槽位]
+ * 各段起始位置以相对区域基址的偏移保存。
+ */
+struct zerolist_shm_region
+{
+    uint32_t        magic;
+    pthread_mutex_t lock;
+    size_t          total_size;
+    size_t          nodes_off;
+    size_t          stack_off;
+    size_t          payload_off;
+    size_t          elem_size;
+    ZEROLIST_TYPE   max_nodes;
+    ZEROLIST_TYPE   head;
+    ZEROLIST_TYPE   size;
+    ZEROLIST_TYPE   free_top;
+};
+
+#define _ZEROLIST_SHM_NODES(r) ((_zerolist_shm_node_t*)((uint8_t*)(r) + (r)->nodes_off))
+#define _ZEROLIST_SHM_STACK(r) ((ZEROLIST_TYPE*)((uint8_t*)(r) + (r)->stack_off))
+#define _ZEROLIST_SHM_PAYLOAD(r, idx) \
+    ((void*)((uint8_t*)(r) + (r)->payload_off + (size_t)(idx) * (r)->elem_size))
+
+static size_t _zerolist_shm_layout(ZEROLIST_TYPE max_nodes, size_t elem_size, size_t* nodes_off,
+                                   size_t* stack_off, size_t* payload_off)
+{
+    size_t off = _ZEROLIST_SHM_ROUND(sizeof(zerolist_shm_region_t));
+    *nodes_off = off;
+    off += _ZEROLIST_SHM_ROUND((size_t)max_nodes * sizeof(_zerolist_shm_node_t));
+    *stack_off = off;
+    off += _ZEROLIST_SHM_ROUND((size_t)max_nodes * sizeof(ZEROLIST_TYPE));
+    *payload_off = off;
+    off += (size_t)max_nodes * _ZEROLIST_SHM_ROUND(elem_size);
+    return off;
+}
+
+/*
+ * 加锁；如果上一个持锁进程在临界区内崩溃，接管锁并标记为一致。
+ * 所有临界区都只修改少量下标，崩溃最多丢失一个正在链接的节点。
+ */
+static bool _zerolist_shm_lock(zerolist_shm_region_t* r)
+{
+    int rc = pthread_mutex_lock(&r->lock);
+    if (rc == EOWNERDEAD) {
+        pthread_mutex_consistent(&r->lock);
+        rc = 0;
+    }
+    return rc == 0;
+}
+
+static inline void _zerolist_shm_unlock(zerolist_shm_region_t* r)
+{
+    pthread_mutex_unlock(&r->lock);
+}
+
+// 负载指针 -> 槽位下标，不属于该区域返回 ZEROLIST_SHM_NIL
+static ZEROLIST_TYPE _zerolist_shm_index_of(zerolist_shm_region_t* r, const void* payload)
+{
+    uintptr_t base = (uintptr_t)_ZEROLIST_SHM_PAYLOAD(r, 0);
+    uintptr_t addr = (uintptr_t)payload;
+    if (addr < base) return ZEROLIST_SHM_NIL;
+    uintptr_t offset = addr - base;
+    if (offset % r->elem_size != 0) return ZEROLIST_SHM_NIL;
+    uintptr_t idx = offset / r->elem_size;
+    return idx < r->max_nodes ? (ZEROLIST_TYPE)idx : ZEROLIST_SHM_NIL;
+}
+
+bool zerolist_shm_create(zerolist_shm_t* shm, const char* name, ZEROLIST_TYPE max_nodes,
+                         size_t elem_size)
+{
+    if (!shm || !name || max_nodes == 0 || max_nodes == ZEROLIST_SHM_NIL || elem_size == 0) {
+        return false;
+    }
+
+    size_t nodes_off, stack_off, payload_off;
+    size_t total = _zerolist_shm_layout(max_nodes, elem_size, &nodes_off, &stack_off, &payload_off);
+
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) return false;
+    if (ftruncate(fd, (off_t)total) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return false;
+    }
+    void* mem = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(name);
+        return false;
+    }
+
+    zerolist_shm_region_t* r = (zerolist_shm_region_t*)mem;
+    r->total_size            = total;
+    r->nodes_off             = nodes_off;
+    r->stack_off             = stack_off;
+    r->payload_off           = payload_off;
+    r->elem_size             = _ZEROLIST_SHM_ROUND(elem_size);
+    r->max_nodes             = max_nodes;
+    r->head                  = ZEROLIST_SHM_NIL;
+    r->size                  = 0;
+    r->free_top              = max_nodes;
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    int rc = pthread_mutex_init(&r->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (rc != 0) {
+        munmap(mem, total);
+        shm_unlink(name);
+        return false;
+    }
+
+    _zerolist_shm_node_t* nodes = _ZEROLIST_SHM_NODES(r);
+    ZEROLIST_TYPE*        stack = _ZEROLIST_SHM_STACK(r);
+    for (ZEROLIST_TYPE i = 0; i < max_nodes; i++) {
+        nodes[i].prev = nodes[i].next = ZEROLIST_SHM_NIL;
+        nodes[i].in_use = nodes[i].linked = 0;
+        stack[i]                          = (ZEROLIST_TYPE)(max_nodes - 1 - i);
+    }
+
+    // magic 最后写入：其他进程看到 magic 即表示区域已初始化完成
+    __sync_synchronize();
+    r->magic = _ZEROLIST_SHM_MAGIC;
+
+    shm->region   = r;
+    shm->map_size = total;
+    return true;
+}
+
+bool zerolist_shm_open(zerolist_shm_t* shm, const char* name)
+{
+    if (!shm || !name) return false;
+
+    int fd = shm_open(name, O_RDWR, 0600);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(zerolist_shm_region_t)) {
+        close(fd);
+        return false;
+    }
+    size_t total = (size_t)st.st_size;
+    void*  mem   = mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) return false;
+
+    zerolist_shm_region_t* r = (zerolist_shm_region_t*)mem;
+    __sync_synchronize();
+    if (r->magic != _ZEROLIST_SHM_MAGIC || r->total_size != total) {
+        munmap(mem, total);
+        return false;
+    }
+
+    shm->region   = r;
+    shm->map_size = total;
+    return true;
+}
+
+void zerolist_shm_close(zerolist_shm_t* shm)
+{
+    if (!shm || !shm->region) return;
+    munmap(shm->region, shm->map_size);
+    shm->region   = NULL;
+    shm->map_size = 0;
+}
+
+bool zerolist_shm_unlink(const char* name)
+{
+    if (!name) return false;
+    return shm_unlink(name) == 0;
+}
+
+void* zerolist_shm_alloc(zerolist_shm_t* shm)
+{
+    if (!shm || !shm->region) return NULL;
+    zerolist_shm_region_t* r = shm->region;
+    if (!_zerolist_shm_lock(r)) return NULL;
+
+    void* payload = NULL;
+    if (r->free_top > 0) {
+        ZEROLIST_TYPE         idx  = _ZEROLIST_SHM_STACK(r)[--r->free_top];
+        _zerolist_shm_node_t* node = &_ZEROLIST_SHM_NODES(r)[idx];
+        node->in_use               = 1;
+        node->linked               = 0;
+        node->prev = node->next = ZEROLIST_SHM_NIL;
+        payload                 = _ZEROLIST_SHM_PAYLOAD(r, idx);
+    }
+
+    _zerolist_shm_unlock(r);
+    return payload;
+}
+
+void zerolist_shm_free(zerolist_shm_t* shm, void* payload)
+{
+    if (!shm || !shm->region || !payload) return;
+    zerolist_shm_region_t* r   = shm->region;
+    ZEROLIST_TYPE          idx = _zerolist_shm_index_of(r, payload);
+    if (idx == ZEROLIST_SHM_NIL) return;
+    if (!_zerolist_shm_lock(r)) return;
+
+    _zerolist_shm_node_t* node = &_ZEROLIST_SHM_NODES(r)[idx];
+    // 仅归还已预留且未链接的槽位，防止重复释放或释放队列中的节点
+    if (node->in_use && !node->linked && r->free_top < r->max_nodes) {
+        node->in_use                          = 0;
+        _ZEROLIST_SHM_STACK(r)[r->free_top++] = idx;
+    }
+
+    _zerolist_shm_unlock(r);
+}
+
+bool zerolist_shm_push_back(zerolist_shm_t* shm, void* payload)
+{
+    if (!shm || !shm->region || !payload) return false;
+    zerolist_shm_region_t* r   = shm->region;
+    ZEROLIST_TYPE          idx = _zerolist_shm_index_of(r, payload);
+    if (idx == ZEROLIST_SHM_NIL) return false;
+    if (!_zerolist_shm_lock(r)) return false;
+
+    _zerolist_shm_node_t* nodes = _ZEROLIST_SHM_NODES(r);
+    _zerolist_shm_node_t* node  = &nodes[idx];
+    bool                  ok    = node->in_use && !node->linked;
+    if (ok) {
+        if (r->head == ZEROLIST_SHM_NIL) {
+            node->prev = node->next = idx;
+            r->head                 = idx;
+        } else {
+            ZEROLIST_TYPE tail = nodes[r->head].prev;
+            node->prev         = tail;
+            node->next         = r->head;
+            nodes[tail].next   = idx;
+            nodes[r->head].prev = idx;
+        }
+        node->linked = 1;
+        r->size++;
+    }
+
+    _zerolist_shm_unlock(r);
+    return ok;
+}
+
+void* zerolist_shm_pop_front(zerolist_shm_t* shm)
+{
+    if (!shm || !shm->region) return NULL;
+    zerolist_shm_region_t* r = shm->region;
+    if (!_zerolist_shm_lock(r)) return NULL;
+
+    void* payload = NULL;
+    if (r->head != ZEROLIST_SHM_NIL) {
+        _zerolist_shm_node_t* nodes = _ZEROLIST_SHM_NODES(r);
+        ZEROLIST_TYPE         idx   = r->head;
+        _zerolist_shm_node_t* node  = &nodes[idx];
+        if (node->next == idx) {
+            r->head = ZEROLIST_SHM_NIL;
+        } else {
+            nodes[node->prev].next = node->next;
+            nodes[node->next].prev = node->prev;
+            r->head                = node->next;
+        }
+        node->prev = node->next = ZEROLIST_SHM_NIL;
+        node->linked            = 0;
+        r->size--;
+        payload = _ZEROLIST_SHM_PAYLOAD(r, idx);
+    }
+
+    _zerolist_shm_unlock(r);
+    return payload;
+}
+
+ZEROLIST_TYPE zerolist_shm_size(zerolist_shm_t* shm)
+{
+    if (!shm || !shm->region) return 0;
+    zerolist_shm_region_t* r = shm->region;
+    if (!_zerolist_shm_lock(r)) return 0;
+    ZEROLIST_TYPE size = r->size;
+    _zerolist_shm_unlock(r);
+    return size;
+}
+
+#endif  // ZEROLIST_SHM_ENABLE
+
+#if ZEROLIST_DIRTY_TRACK
+// ===========================================
+// 增量检查点
+// ===========================================
+
+size_t zerolist_checkpoint_delta(Zerolist* list, zerolist_delta_sink_t sink, void* ctx,
+                                 zerolist_delta_hdr_t* hdr)
+{
+    if (!list || !hdr || !list->node_buf || !list->dirty_bits) return 0;
+
+    // 头与记录都会被原样持久化或发送：先整体清零，填充字节与未用字段不带出栈上内容
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->max_nodes = list->max_nodes;
+    hdr->size      = zerolist_size(list);
+    hdr->has_head  = list->head != NULL;
+    hdr->head      = list->head ? (ZEROLIST_TYPE)(list->head - list->node_buf) : 0;
+#if ZEROLIST_LAZY_REVERSE
+    hdr->reversed = list->reversed;
+#endif
+#if ZEROLIST_FAST_ALLOC
+    hdr->free_top = list->free_top;
+    hdr->free_low = list->dirty_free_low < list->free_top ? list->dirty_free_low : list->free_top;
+#endif
+
+    size_t count = 0;
+    size_t bytes = ZEROLIST_DIRTY_BYTES(list->max_nodes);
+    for (size_t b = 0; b < bytes; b++) {
+        // 整字跳过干净区域：大缓冲区中脏槽位通常很稀疏
+        if ((b & 7u) == 0 && b + 8 <= bytes) {
+            uint64_t word;
+            memcpy(&word, &list->dirty_bits[b], sizeof(word));
+            if (word == 0) {
+                b += 7;
+                continue;
+            }
+        }
+        uint8_t bits = list->dirty_bits[b];
+        if (!bits) continue;
+        list->dirty_bits[b] = 0;
+        for (unsigned bit = 0; bit < 8; bit++) {
+            if (!(bits & (1u << bit))) continue;
+            size_t idx = (b << 3) + bit;
+            if (idx >= list->max_nodes) break;
+
+            zerolist_node_t*     node = &list->node_buf[idx];
+            zerolist_delta_rec_t rec;
+            memset(&rec, 0, sizeof(rec));
+            rec.kind   = ZEROLIST_DELTA_SLOT;
+            rec.index  = (ZEROLIST_TYPE)idx;
+            rec.in_use = node->flags.in_use;
+            rec.data   = node->data;
+#if ZEROLIST_BUFCHAIN_ENABLE
+            rec.len = node->len;
+            rec.off = node->off;
+#endif
+            // 空闲槽位的链接无意义（可能从未设置），按自环输出
+            rec.prev = rec.in_use ? (ZEROLIST_TYPE)(node->prev - list->node_buf) : rec.index;
+            rec.next = rec.in_use ? (ZEROLIST_TYPE)(node->next - list->node_buf) : rec.index;
+            if (sink) sink(ctx, &rec);
+            count++;
+        }
+    }
+
+#if ZEROLIST_FAST_ALLOC
+    // 空闲栈中变化过的区间按值输出，副本无需访问主链表的内存
+    for (ZEROLIST_TYPE i = hdr->free_low; i < hdr->free_top; i++) {
+        zerolist_delta_rec_t rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.kind  = ZEROLIST_DELTA_FREE;
+        rec.index = i;
+        rec.prev  = list->free_stack[i];
+        rec.next  = list->free_stack[i];
+        if (sink) sink(ctx, &rec);
+        count++;
+    }
+    list->dirty_free_low = list->free_top;
+#endif
+    return count;
+}
+
+bool zerolist_apply_delta(Zerolist* replica, const zerolist_delta_hdr_t* hdr,
+                          const zerolist_delta_rec_t* recs, size_t count)
+{
+    if (!replica || !hdr || (count && !recs) || !replica->node_buf) return false;
+
+    if (hdr->max_nodes > replica->max_nodes) {
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+        if (!_zerolist_expand_buffer(replica, hdr->max_nodes)) return false;
+#else
+        return false;
+#endif
+    }
+
+#if ZEROLIST_FAST_ALLOC
+    if (hdr->free_top > replica->max_nodes || !replica->free_stack) return false;
+#endif
+
+    _ZEROLIST_MODIFIED(replica);
+    _ZEROLIST_AGG_STALE(replica);
+    zerolist_node_t* buf = replica->node_buf;
+    for (size_t i = 0; i < count; i++) {
+        const zerolist_delta_rec_t* rec = &recs[i];
+        if (rec->index >= replica->max_nodes) return false;
+        if (rec->kind == ZEROLIST_DELTA_FREE) {
+#if ZEROLIST_FAST_ALLOC
+            replica->free_stack[rec->index] = rec->next;
+#endif
+            continue;
+        }
+        zerolist_node_t* node = &buf[rec->index];
+        node->flags.in_use    = rec->in_use;
+        node->flags.index     = rec->index;
+        node->data            = rec->data;
+        _ZEROLIST_BUF_COPY(node, rec);
+        node->prev = rec->prev < replica->max_nodes ? &buf[rec->prev] : node;
+        node->next = rec->next < replica->max_nodes ? &buf[rec->next] : node;
+        _ZEROLIST_DIRTY_MARK(replica, node);
+    }
+
+    replica->head = hdr->has_head ? &buf[hdr->head] : NULL;
+#if ZEROLIST_LAZY_REVERSE
+    replica->reversed = hdr->reversed;
+#endif
+#if ZEROLIST_SIZE_ENABLE
+    replica->size = hdr->size;
+#endif
+#if ZEROLIST_FAST_ALLOC
+    replica->free_top = hdr->free_top;
+#endif
+    _ZEROLIST_BLOOM_REFILL(replica);
+    _ZEROLIST_INDEX_REFILL(replica);
+    _ZEROLIST_KEY_REFILL(replica);
+    _ZEROLIST_ORDER_RELABEL(replica);
+    return true;
+}
+#endif  // ZEROLIST_DIRTY_TRACK
+
+#if ZEROLIST_VIEW_ENABLE
+// ===========================================
+// 零拷贝子链表视图
+// ===========================================
+
+bool zerolist_view_from_node(zerolist_view_t* view, Zerolist* list, zerolist_node_t* start,
+                             ZEROLIST_TYPE count)
+{
+    if (!view || !list) return false;
+    view->list      = list;
+    view->start     = count ? start : NULL;
+    view->count     = start ? count : 0;
+    view->mod_count = list->mod_count;
+    return true;
+}
+
+bool zerolist_view_from_index(zerolist_view_t* view, Zerolist* list, ZEROLIST_TYPE index,
+                              ZEROLIST_TYPE count)
+{
+    if (!view || !list) return false;
+    zerolist_node_t* start = _zerolist_node_at(list, index);
+    if (!start && count) return false;
+    return zerolist_view_from_node(view, list, start, count);
+}
+
+bool zerolist_view_valid(const zerolist_view_t* view)
+{
+    return view && view->list && view->mod_count == view->list->mod_count;
+}
+
+void* zerolist_view_at(const zerolist_view_t* view, ZEROLIST_TYPE index)
+{
+    if (!zerolist_view_valid(view) || index >= view->count) return NULL;
+    ZEROLIST_TYPE i = 0;
+    ZEROLIST_VIEW_FOR_EACH(view, node)
+    {
+        if (i++ == index) return node->data;
+    }
+    return NULL;
+}
+
+zerolist_node_t* zerolist_view_find(const zerolist_view_t* view, const void* target_addr)
+{
+    if (!zerolist_view_valid(view)) return NULL;
+    ZEROLIST_VIEW_FOR_EACH(view, node)
+    {
+        if (node->data == target_addr) return node;
+    }
+    return NULL;
+}
+
+zerolist_node_t* zerolist_view_search(const zerolist_view_t* view, const void* target_data,
+                                      bool (*cmp_func)(const void*, const void*))
+{
+    if (!zerolist_view_valid(view) || !cmp_func) return NULL;
+    ZEROLIST_VIEW_FOR_EACH(view, node)
+    {
+        if (cmp_func(node->data, target_data)) return node;
+    }
+    return NULL;
+}
+
+void zerolist_view_foreach(const zerolist_view_t* view, void (*callback)(void* data))
+{
+    if (!zerolist_view_valid(view) || !callback) return;
+    ZEROLIST_VIEW_FOR_EACH(view, node)
+    {
+        callback(node->data);
+    }
+}
+#endif  // ZEROLIST_VIEW_ENABLE
+
+#if ZEROLIST_BUFCHAIN_ENABLE
+// ===========================================
+// 分散/聚集缓冲区链
+// ===========================================
+
+bool zerolist_push_back_buf(Zerolist* list, void* buf, size_t len)
+{
+    if (!list || (!buf && len)) return false;
+    if (!_zerolist_insert_internal(list, NULL, buf, false)) return false;
+
+    zerolist_node_t* tail = _ZEROLIST_PREV(list, list->head);
+    tail->len             = len;
+    return true;
+}
+
+int zerolist_to_iovec(Zerolist* list, struct iovec* iov, int max)
+{
+    if (!list || !iov || max <= 0 || !list->head) return 0;
+
+    int              cnt = 0;
+    zerolist_node_t* cur = list->head;
+    do {
+        if (cur->off < cur->len) {
+            iov[cnt].iov_base = (uint8_t*)cur->data + cur->off;
+            iov[cnt].iov_len  = cur->len - cur->off;
+            cnt++;
+        }
+        cur = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head && cnt < max);
+    return cnt;
+}
+
+size_t zerolist_consume(Zerolist* list, size_t nbytes, void (*release)(void* buf, void* ctx),
+                        void* ctx)
+{
+    // 没有消费任何字节时不触碰链表，头部的空缓冲区留给后续的 consume
+    if (!list || nbytes == 0) return 0;
+
+    size_t done = 0;
+    while (list->head) {
+        zerolist_node_t* node   = list->head;
+        size_t           remain = node->len - node->off;
+        if (remain > nbytes - done) {
+            // 部分发送：只推进偏移
+            node->off += nbytes - done;
+            _ZEROLIST_DIRTY_MARK(list, node);
+            done = nbytes;
+            break;
+        }
+        done += remain;
+        void* buf = zerolist_pop_front(list);
+        if (release) release(buf, ctx);
+        if (done == nbytes) break;
+    }
+    return done;
+}
+
+size_t zerolist_pending_bytes(Zerolist* list)
+{
+    if (!list || !list->head) return 0;
+
+    size_t           total = 0;
+    zerolist_node_t* cur   = list->head;
+    do {
+        total += cur->len - cur->off;
+        cur = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head);
+    return total;
+}
+#endif  // ZEROLIST_BUFCHAIN_ENABLE
+
+#if ZEROLIST_AGGREGATE_ENABLE
+// ===========================================
+// 增量聚合
+// ===========================================
+
+void zerolist_set_monoid(Zerolist* list, const zerolist_monoid_t* monoid)
+{
+    if (!list) return;
+    list->monoid    = monoid;
+    list->agg       = monoid ? monoid->identity : 0;
+    list->agg_front = 0;
+    list->agg_stale = monoid && list->head;
+}
+
+ZEROLIST_AGG_TYPE zerolist_aggregate(Zerolist* list)
+{
+    if (!list || !list->monoid) return 0;
+
+    const zerolist_monoid_t* m = list->monoid;
+    if (list->agg_stale) {
+        list->agg       = m->identity;
+        list->agg_front = 0;
+        list->agg_stale = 0;
+        if (!list->head) return list->agg;
+
+        if (!_ZEROLIST_AGG_TWO_STACK(m)) {
+            zerolist_node_t* cur = list->head;
+            do {
+                list->agg = m->combine(list->agg, m->extract(cur->data));
+                cur       = _ZEROLIST_NEXT(list, cur);
+            } while (cur != list->head);
+        } else {
+            // 整个链表重建为前段：从尾到头计算后缀汇总
+            zerolist_node_t*  tail = _ZEROLIST_PREV(list, list->head);
+            zerolist_node_t*  cur  = tail;
+            ZEROLIST_AGG_TYPE acc  = m->identity;
+            do {
+                acc      = m->combine(m->extract(cur->data), acc);
+                cur->agg = acc;
+                cur      = _ZEROLIST_PREV(list, cur);
+                list->agg_front++;
+            } while (cur != tail);
+        }
+    }
+    return _zerolist_agg_total(list);
+}
+
+void zerolist_aggregate_invalidate(Zerolist* list)
+{
+    if (list && list->monoid) _ZEROLIST_AGG_STALE(list);
+}
+#endif  // ZEROLIST_AGGREGATE_ENABLE
+
+#if ZEROLIST_SELF_ORGANIZE
+// ===========================================
+// 自组织查找
+// ===========================================
+
+void zerolist_set_search_policy(Zerolist* list, uint8_t policy)
+{
+    if (!list || policy > ZEROLIST_SEARCH_COUNT) return;
+    list->search_policy = policy;
+}
+
+zerolist_search_stats_t zerolist_get_search_stats(Zerolist* list)
+{
+    zerolist_search_stats_t stats = { 0, 0, 0 };
+    if (list) stats = list->search_stats;
+    return stats;
+}
+
+void zerolist_reset_search_stats(Zerolist* list)
+{
+    if (!list) return;
+    memset(&list->search_stats, 0, sizeof(list->search_stats));
+    if (!list->head) return;
+    zerolist_node_t* cur = list->head;
+    do {
+        cur->hits = 0;
+        cur       = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head);
+}
+#endif  // ZEROLIST_SELF_ORGANIZE
+
+#if ZEROLIST_KEY_ENABLE
+// ===========================================
+// 节点内联键指纹
+// ===========================================
+
+void zerolist_set_key_func(Zerolist* list, ZEROLIST_KEY_TYPE (*key_func)(const void* data))
+{
+    if (!list) return;
+    list->key_func = key_func;
+    _ZEROLIST_KEY_REFILL(list);
+}
+
+zerolist_node_t* zerolist_search_key(Zerolist* list, ZEROLIST_KEY_TYPE key,
+                                     const void* target_data,
+                                     bool (*cmp_func)(const void*, const void*))
+{
+    if (!list) return NULL;
+    if (!list->key_func) {
+        // 没有键可比较：cmp_func 为 NULL 时按数据指针相等查找
+        return cmp_func ? zerolist_search(list, target_data, cmp_func)
+                        : zerolist_find(list, target_data);
+    }
+#if ZEROLIST_SELF_ORGANIZE
+    list->search_stats.searches++;
+#endif
+    if (!list->head) return NULL;
+
+    // 键不相等的节点只读取节点本身，不解引用 data
+    zerolist_node_t* cur   = list->head;
+    uint32_t         depth = 0;
+    do {
+        depth++;
+        if (cur->key == key && (!cmp_func || cmp_func(cur->data, target_data))) {
+#if ZEROLIST_SELF_ORGANIZE
+            list->search_stats.found++;
+            list->search_stats.probes += depth;
+            _zerolist_search_promote(list, cur);
+#endif
+            return cur;
+        }
+        cur = _ZEROLIST_NEXT(list, cur);
+    } while (cur != list->head);
+#if ZEROLIST_SELF_ORGANIZE
+    list->search_stats.probes += depth;
+#else
+    (void)depth;
+#endif
+    return NULL;
+}
+#endif  // ZEROLIST_KEY_ENABLE
+
+#if ZEROLIST_BLOOM_ENABLE
+// ===========================================
+// 计数布隆过滤器
+// ===========================================
+
+bool zerolist_may_contain(Zerolist* list, const void* data)
+{
+    if (!list || !list->head) return false;
+    if (!list->bloom) return true;
+
+    uint64_t h = _zerolist_ptr_hash(data);
+    for (uint32_t i = 0; i < ZEROLIST_BLOOM_HASHES; i++) {
+        if (!list->bloom[_zerolist_bloom_slot(h, i, list->bloom_slots)]) return false;
+    }
+    return true;
+}
+#endif  // ZEROLIST_BLOOM_ENABLE
+
+#if ZEROLIST_UNIQUE_ENABLE
+// ===========================================
+// 去重合并队列
+// ===========================================
+
+// 查找数据为 data 的节点：优先走成员索引，索引不可用时按链表遍历（不触发自组织调整）
+static zerolist_node_t* _zerolist_unique_lookup(Zerolist* list, const void* data)
+{
+    if (list->index) return _zerolist_index_find(list, data, NULL);
+    _ZEROLIST_FOREACH_NODE_DYNAMIC(list, node, {
+        if (node->data == data) return node;
+    });
+    return NULL;
+}
+
+bool zerolist_push_back_unique(Zerolist* list, void* data, bool move_to_back)
+{
+    if (!list) return false;
+
+    zerolist_node_t* node = _zerolist_unique_lookup(list, data);
+    if (!node) return _zerolist_insert_internal(list, NULL, data, false);
+    if (move_to_back) _zerolist_move_to_back(list, node);
+    return true;
+}
+
+bool zerolist_contains(Zerolist* list, const void* data)
+{
+    if (!list || !list->head) return false;
+    return _zerolist_unique_lookup(list, data) != NULL;
+}
+#endif  // ZEROLIST_UNIQUE_ENABLE
+
+#if ZEROLIST_DEFER_ENABLE
+// ===========================================
+// 延迟修改日志
+// ===========================================
+
+// 槽位 seq 统一减去槽位下标保存，全零的日志即为空日志：
+// 可写 = 轮次基址，已写入 = 基址 + 1，已消费 = 基址 + 槽位数（即下一轮的可写状态）
+#define _ZEROLIST_DEFER_MASK       ((uint32_t)ZEROLIST_DEFER_SLOTS - 1)
+#define _ZEROLIST_DEFER_BASE(pos)  ((pos) & ~_ZEROLIST_DEFER_MASK)
+#define _ZEROLIST_DEFER_LOOKUP(op) ((op) >= ZEROLIST_DEFER_REMOVE)
+
+bool zerolist_defer(Zerolist* list, zerolist_defer_op_t op, void* data)
+{
+    if (!list || !data || (unsigned)op > ZEROLIST_DEFER_MOVE_BACK) return false;
+
+    zerolist_defer_log_t*   log = &list->pending;
+    zerolist_defer_entry_t* entry;
+    uint32_t                pos = __atomic_load_n(&log->enq, __ATOMIC_RELAXED);
+    for (;;) {
+        entry        = &log->entry[pos & _ZEROLIST_DEFER_MASK];
+        uint32_t seq = __atomic_load_n(&entry->seq, __ATOMIC_ACQUIRE);
+        int32_t  dif = (int32_t)(seq - _ZEROLIST_DEFER_BASE(pos));
+        if (dif == 0) {
+            // 失败时 pos 被更新为最新的生产者位置
+            if (__atomic_compare_exchange_n(&log->enq, &pos, pos + 1, true, __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (dif < 0) {
+            return false;  // 上一轮的记录尚未被应用
+        } else {
+            pos = __atomic_load_n(&log->enq, __ATOMIC_RELAXED);
+        }
+    }
+    entry->op   = (uint8_t)op;
+    entry->data = data;
+    __atomic_store_n(&entry->seq, _ZEROLIST_DEFER_BASE(pos) + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+// 按顺序取出已写入完成的记录（遇到尚在写入的槽位即停止）
+static size_t _zerolist_defer_drain(zerolist_defer_log_t* log, zerolist_defer_entry_t* out)
+{
+    size_t   n   = 0;
+    uint32_t pos = log->deq;
+    while (n < ZEROLIST_DEFER_SLOTS) {
+        zerolist_defer_entry_t* entry = &log->entry[pos & _ZEROLIST_DEFER_MASK];
+        if (__atomic_load_n(&entry->seq, __ATOMIC_ACQUIRE) != _ZEROLIST_DEFER_BASE(pos) + 1) {
+            break;
+        }
+        out[n].op   = entry->op;
+        out[n].data = entry->data;
+        n++;
+        __atomic_store_n(&entry->seq, _ZEROLIST_DEFER_BASE(pos) + ZEROLIST_DEFER_SLOTS,
+                         __ATOMIC_RELEASE);
+        pos++;
+    }
+    log->deq = pos;
+    return n;
+}
+
+size_t zerolist_apply_pending(Zerolist* list)
+{
+    if (!list) return 0;
+
+    zerolist_defer_entry_t ops[ZEROLIST_DEFER_SLOTS];
+    size_t                 n = _zerolist_defer_drain(&list->pending, ops);
+    if (n == 0) return 0;
+
+    // 候选节点：遍历找到的原有节点与本批次 PUSH 的新节点（总数不超过记录数）。
+    // rank 按链表中的相对次序递增，删除/移动记录的目标取同数据、rank 最小的候选，
+    // 即逐条立即执行时“第一个数据为 data 的节点”
+    zerolist_node_t* pool[ZEROLIST_DEFER_SLOTS];
+    int32_t          rank[ZEROLIST_DEFER_SLOTS];
+    bool             claimed[ZEROLIST_DEFER_SLOTS] = { false };
+    size_t           pooled                        = 0;
+    size_t           unresolved                    = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (_ZEROLIST_DEFER_LOOKUP(ops[i].op)) unresolved++;
+    }
+
+    // 一次遍历：每条删除/移动记录按链表次序认领一个不同的同数据节点。
+    // k 条同数据记录最多让 k-1 个节点离开首位，收集前 k 个即可覆盖所有目标
+    zerolist_node_t* cur = list->head;
+    while (cur && unresolved) {
+        for (size_t i = 0; i < n; i++) {
+            if (claimed[i] || !_ZEROLIST_DEFER_LOOKUP(ops[i].op) || ops[i].data != cur->data) {
+                continue;
+            }
+            claimed[i]     = true;
+            rank[pooled]   = (int32_t)pooled;
+            pool[pooled++] = cur;
+            unresolved--;
+            break;
+        }
+        cur = _ZEROLIST_NEXT(list, cur);
+        if (cur == list->head) break;
+    }
+
+    int32_t front = 0;                // 下一个移到表头的 rank 为 --front
+    int32_t back  = (int32_t)pooled;  // 下一个移到队尾的 rank 为 back++
+    for (size_t i = 0; i < n; i++) {
+        void* data = ops[i].data;
+        if (!_ZEROLIST_DEFER_LOOKUP(ops[i].op)) {
+            bool at_front = ops[i].op == ZEROLIST_DEFER_PUSH_FRONT;
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+            zerolist_node_t* old_buf = list->node_buf;
+#endif
+            if (!_zerolist_insert_internal(list, at_front ? list->head : NULL, data, at_front)) {
+                continue;
+            }
+#if ZEROLIST_STATIC_DYNAMIC_EXPAND
+            // 插入触发扩容时缓冲区可能搬迁，候选节点按下标重定位
+            if (list->node_buf != old_buf) {
+                for (size_t k = 0; k < pooled; k++) {
+                    if (pool[k]) pool[k] = &list->node_buf[pool[k] - old_buf];
+                }
+            }
+#endif
+            rank[pooled]   = at_front ? --front : back++;
+            pool[pooled++] = at_front ? list->head : _ZEROLIST_PREV(list, list->head);
+            continue;
+        }
+
+        size_t best = pooled;
+        for (size_t k = 0; k < pooled; k++) {
+            if (pool[k] && pool[k]->data == data && (best == pooled || rank[k] < rank[best])) {
+                best = k;
+            }
+        }
+        if (best == pooled) continue;  // 链表中已没有该数据：忽略
+
+        zerolist_node_t* target = pool[best];
+        if (ops[i].op == ZEROLIST_DEFER_REMOVE) {
+            pool[best] = NULL;
+            _zerolist_detach_node(list, target);
+            zerolist_free_node(list, target);
+#if ZEROLIST_SIZE_ENABLE
+            list->size--;
+#endif
+        } else if (ops[i].op == ZEROLIST_DEFER_MOVE_FRONT) {
+            rank[best] = --front;
+            _zerolist_move_before(list, target, list->head);
+        } else {
+            rank[best] = back++;
+            _zerolist_move_to_back(list, target);
+        }
+    }
+    return n;
+}
+#endif  // ZEROLIST_DEFER_ENABLE
+
+#if ZEROLIST_MULTI_ENABLE
+// ===========================================
+// 多链表成员节点
+// ===========================================
+
+#define _ZEROLIST_MLINK(node, slot) ((node)->link[(slot)])
+
+// 节点是否属于该池：缓冲区节点按地址判断；malloc 回退节点无从判断，视为属于
+static inline bool _zerolist_mpool_owns(const zerolist_mpool_t* pool, const zerolist_mnode_t* node)
+{
+    if (node->heap) return true;
+    return pool->node_buf && node >= pool->node_buf && node < pool->node_buf + pool->max_nodes;
+}
+
+// 把节点从 list 中摘除（调用方保证节点在链表中）
+static void _zerolist_mlist_unlink(zerolist_mlist_t* list, zerolist_mnode_t* node)
+{
+    uint8_t           slot = list->slot;
+    zerolist_mnode_t* prev = _ZEROLIST_MLINK(node, slot).prev;
+    zerolist_mnode_t* next = _ZEROLIST_MLINK(node, slot).next;
+
+    if (next == node) {
+        list->head = NULL;
+    } else {
+        _ZEROLIST_MLINK(prev, slot).next = next;
+        _ZEROLIST_MLINK(next, slot).prev = prev;
+        if (list->head == node) list->head = next;
+    }
+    node->member &= ~(1u << slot);
+    list->size--;
+}
+
+// 把节点链接到 list 尾部；front 为 true 时成为新的头节点
+static void _zerolist_mlist_link(zerolist_mlist_t* list, zerolist_mnode_t* node, bool front)
+{
+    uint8_t           slot = list->slot;
+    zerolist_mnode_t* head = list->head;
+
+    if (!head) {
+        _ZEROLIST_MLINK(node, slot).prev = node;
+        _ZEROLIST_MLINK(node, slot).next = node;
+        list->head                       = node;
+    } else {
+        zerolist_mnode_t* tail           = _ZEROLIST_MLINK(head, slot).prev;
+        _ZEROLIST_MLINK(node, slot).prev = tail;
+        _ZEROLIST_MLINK(node, slot).next = head;
+        _ZEROLIST_MLINK(tail, slot).next = node;
+        _ZEROLIST_MLINK(head, slot).prev = node;
+        if (front) list->head = node;
+    }
+    node->member |= 1u << slot;
+    list->size++;
+}
+
+void zerolist_mpool_init(zerolist_mpool_t* pool, zerolist_mnode_t* buf, ZEROLIST_TYPE max_nodes)
+{
+    if (!pool) return;
+
+    pool->node_buf  = buf;
+    pool->max_nodes = buf ? max_nodes : 0;
+    pool->used      = 0;
+    pool->free_list = NULL;
+    for (uint8_t i = 0; i < ZEROLIST_MULTI_LINKS; i++) {
+        pool->lists[i] = NULL;
+    }
+    // 逆序压入空闲链，使分配按缓冲区顺序进行
+    for (ZEROLIST_TYPE i = pool->max_nodes; i > 0; i--) {
+        zerolist_mnode_t* node = &buf[i - 1];
+        node->data             = NULL;
+        node->member           = 0;
+        node->in_use           = 0;
+        node->heap             = 0;
+        node->link[0].next     = pool->free_list;
+        pool->free_list        = node;
+    }
+}
+
+void zerolist_mpool_clear(zerolist_mpool_t* pool)
+{
+    if (!pool) return;
+    // 先释放挂在各链表上的节点，再回收缓冲区中不在任何链表里的在用节点；
+    // 不在任何链表中的 malloc 回退节点无从查找，需由调用方自行释放
+    for (uint8_t i = 0; i < ZEROLIST_MULTI_LINKS; i++) {
+        zerolist_mlist_t* list = pool->lists[i];
+        while (list && list->head) {
+            zerolist_mnode_release(pool, list->head);
+        }
+    }
+    for (ZEROLIST_TYPE i = 0; i < pool->max_nodes; i++) {
+        if (pool->node_buf[i].in_use) zerolist_mnode_release(pool, &pool->node_buf[i]);
+    }
+}
+
+bool zerolist_mlist_init(zerolist_mlist_t* list, zerolist_mpool_t* pool, uint8_t slot)
+{
+    if (!list || !pool || slot >= ZEROLIST_MULTI_LINKS) return false;
+    if (pool->lists[slot] && pool->lists[slot] != list) return false;
+
+    list->pool        = pool;
+    list->head        = NULL;
+    list->size        = 0;
+    list->slot        = slot;
+    pool->lists[slot] = list;
+    return true;
+}
+
+zerolist_mnode_t* zerolist_mnode_alloc(zerolist_mpool_t* pool, void* data)
+{
+    if (!pool) return NULL;
+
+    zerolist_mnode_t* node = pool->free_list;
+    if (node) {
+        pool->free_list = node->link[0].next;
+    } else {
+#if ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC
+        node = (zerolist_mnode_t*)ZEROLIST_MALLOC(sizeof(zerolist_mnode_t));
+        if (!node) return NULL;
+        node->heap = 1;
+#else
+        return NULL;
+#endif
+    }
+    node->data   = data;
+    node->member = 0;
+    node->in_use = 1;
+    pool->used++;
+    return node;
+}
+
+void zerolist_mnode_release(zerolist_mpool_t* pool, zerolist_mnode_t* node)
+{
+    if (!pool || !node || !_zerolist_mpool_owns(pool, node) || !node->in_use) return;
+
+    // 只遍历位图中置位的槽位
+    uint32_t member = node->member;
+    while (member) {
+        uint8_t slot = 0;
+        while (!(member & (1u << slot))) slot++;
+        member &= ~(1u << slot);
+        if (pool->lists[slot]) _zerolist_mlist_unlink(pool->lists[slot], node);
+    }
+
+    node->data   = NULL;
+    node->member = 0;
+    node->in_use = 0;
+    pool->used--;
+    if (!node->heap) {
+        node->link[0].next = pool->free_list;
+        pool->free_list    = node;
+    } else {
+        ZEROLIST_FREE(node);
+    }
+}
+
+bool zerolist_mnode_in(const zerolist_mlist_t* list, const zerolist_mnode_t* node)
+{
+    if (!list || !node || !list->pool || !_zerolist_mpool_owns(list->pool, node)) return false;
+    return (node->member >> list->slot) & 1u;
+}
+
+bool zerolist_mlist_push_front(zerolist_mlist_t* list, zerolist_mnode_t* node)
+{
+    if (!list || !node || !list->pool || !_zerolist_mpool_owns(list->pool, node)) return false;
+    if (!node->in_use || zerolist_mnode_in(list, node)) return false;
+    _zerolist_mlist_link(list, node, true);
+    return true;
+}
+
+bool zerolist_mlist_push_back(zerolist_mlist_t* list, zerolist_mnode_t* node)
+{
+    if (!list || !node || !list->pool || !_zerolist_mpool_owns(list->pool, node)) return false;
+    if (!node->in_use || zerolist_mnode_in(list, node)) return false;
+    _zerolist_mlist_link(list, node, false);
+    return true;
+}
+
+bool zerolist_mlist_remove(zerolist_mlist_t* list, zerolist_mnode_t* node)
+{
+    if (!zerolist_mnode_in(list, node)) return false;
+    _zerolist_mlist_unlink(list, node);
+    return true;
+}
+
+bool zerolist_mlist_move_to_back(zerolist_mlist_t* list, zerolist_mnode_t* node)
+{
+    if (!zerolist_mnode_in(list, node)) return false;
+    uint8_t slot = list->slot;
+    if (node == list->head) {
+        // 头节点移到尾部即整个环前进一步
+        list->head = _ZEROLIST_MLINK(node, slot).next;
+    } else if (node != _ZEROLIST_MLINK(list->head, slot).prev) {
+        _zerolist_mlist_unlink(list, node);
+        _zerolist_mlist_link(list, node, false);
+    }
+    return true;
+}
+
+zerolist_mnode_t* zerolist_mlist_pop_front(zerolist_mlist_t* list)
+{
+    if (!list || !list->head) return NULL;
+    zerolist_mnode_t* node = list->head;
+    _zerolist_mlist_unlink(list, node);
+    return node;
+}
+#endif  // ZEROLIST_MULTI_ENABLE
+
+#if ZEROLIST_ORDER_ENABLE
+// ===========================================
+// 顺序维护标签
+// ===========================================
+
+// 节点相对表头的逻辑位置键：正向为沿 next 的标签差，反转时为沿 prev 的标签差
+static inline uint32_t _zerolist_order_key(Zerolist* list, const zerolist_node_t* node)
+{
+#if ZEROLIST_LAZY_REVERSE
+    if (list->reversed) return list->head->label - node->label;
+#endif
+    return node->label - list->head->label;
+}
+
+bool zerolist_precedes(Zerolist* list, const zerolist_node_t* a, const zerolist_node_t* b)
+{
+    if (!list || !list->head || !a || !b || a == b) return false;
+    return _zerolist_order_key(list, a) < _zerolist_order_key(list, b);
+}
+
+int zerolist_order_compare(Zerolist* list, const zerolist_node_t* a, const zerolist_node_t* b)
+{
+    if (!list || !list->head || !a || !b || a == b) return 0;
+    return _zerolist_order_key(list, a) < _zerolist_order_key(list, b) ? -1 : 1;
+}
+#endif  // ZEROLIST_ORDER_ENABLE
+
+#if ZEROLIST_PERSISTENT_ENABLE
+// ===========================================
+// 持久化链表版本
+// ===========================================
+
+// 空闲链头编码：高 32 位为版本号，低 32 位为节点下标 + 1
+#define _ZEROLIST_PFREE_PACK(tag, idx) (((uint64_t)(tag) << 32) | (uint32_t)(idx))
+
+static zerolist_pnode_t* _zerolist_ppool_pop(zerolist_ppool_t* pool)
+{
+    uint64_t old = __atomic_load_n(&pool->free_head, __ATOMIC_ACQUIRE);
+    for (;;) {
+        uint32_t idx = (uint32_t)old;
+        if (!idx) return NULL;
+        zerolist_pnode_t* node = &pool->node_buf[idx - 1];
+        uint32_t          next = __atomic_load_n(&node->free_next, __ATOMIC_RELAXED);
+        uint64_t          neu  = _ZEROLIST_PFREE_PACK((old >> 32) + 1, next);
+        if (__atomic_compare_exchange_n(&pool->free_head, &old, neu, true, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_ACQUIRE)) {
+            return node;
+        }
+    }
+}
+
+static void _zerolist_ppool_push(zerolist_ppool_t* pool, zerolist_pnode_t* node)
+{
+    uint32_t idx = (uint32_t)(node - pool->node_buf) + 1;
+    uint64_t old = __atomic_load_n(&pool->free_head, __ATOMIC_RELAXED);
+    uint64_t neu;
+    do {
+        __atomic_store_n(&node->free_next, (uint32_t)old, __ATOMIC_RELAXED);
+        neu = _ZEROLIST_PFREE_PACK((old >> 32) + 1, idx);
+    } while (!__atomic_compare_exchange_n(&pool->free_head, &old, neu, true, __ATOMIC_RELEASE,
+                                          __ATOMIC_RELAXED));
+}
+
+void zerolist_ppool_init(zerolist_ppool_t* pool, zerolist_pnode_t* buf, ZEROLIST_TYPE max_nodes)
+{
+    if (!pool) return;
+
+    pool->node_buf  = buf;
+    pool->max_nodes = buf ? max_nodes : 0;
+    for (ZEROLIST_TYPE i = 0; i < pool->max_nodes; i++) {
+        buf[i].data      = NULL;
+        buf[i].next      = NULL;
+        buf[i].refs      = 0;
+        buf[i].free_next = (uint32_t)i + 2u;
+    }
+    if (pool->max_nodes) buf[pool->max_nodes - 1].free_next = 0;
+    pool->free_head = _ZEROLIST_PFREE_PACK(0, pool->max_nodes ? 1u : 0u);
+}
+
+zerolist_pnode_t* zerolist_pver_push_front(zerolist_ppool_t* pool, zerolist_pnode_t* ver,
+                                           void* data)
+{
+    if (!pool) return NULL;
+
+    zerolist_pnode_t* node = _zerolist_ppool_pop(pool);
+    if (!node) return NULL;
+    node->data = data;
+    node->next = zerolist_pver_retain(ver);
+    // 池中节点计数为 0，acquire 不会对其加引用；置 1 之后节点才对读者可见
+    __atomic_store_n(&node->refs, 1, __ATOMIC_RELEASE);
+    return node;
+}
+
+zerolist_pnode_t* zerolist_pver_pop_front(zerolist_pnode_t* ver, void** data)
+{
+    if (!ver) {
+        if (data) *data = NULL;
+        return NULL;
+    }
+    if (data) *data = ver->data;
+    return zerolist_pver_retain(ver->next);
+}
+
+zerolist_pnode_t* zerolist_pver_retain(zerolist_pnode_t* ver)
+{
+    if (ver) __atomic_add_fetch(&ver->refs, 1, __ATOMIC_RELAXED);
+    return ver;
+}
+
+void zerolist_pver_release(zerolist_ppool_t* pool, zerolist_pnode_t* ver)
+{
+    if (!pool) return;
+
+    // 沿尾部迭代释放，避免长链递归
+    while (ver) {
+        if (__atomic_sub_fetch(&ver->refs, 1, __ATOMIC_ACQ_REL) != 0) return;
+        zerolist_pnode_t* next = ver->next;
+        ver->data              = NULL;
+        ver->next              = NULL;
+        _zerolist_ppool_push(pool, ver);
+        ver = next;
+    }
+}
+
+ZEROLIST_TYPE zerolist_pver_length(const zerolist_pnode_t* ver)
+{
+    ZEROLIST_TYPE count = 0;
+    for (; ver; ver = ver->next) count++;
+    return count;
+}
+
+void zerolist_pcell_publish(zerolist_ppool_t* pool, zerolist_pcell_t* cell, zerolist_pnode_t* ver)
+{
+    if (!pool || !cell) return;
+    zerolist_pver_retain(ver);
+    zerolist_pnode_t* old = __atomic_exchange_n(&cell->ver, ver, __ATOMIC_ACQ_REL);
+    zerolist_pver_release(pool, old);
+}
+
+zerolist_pnode_t* zerolist_pcell_acquire(zerolist_ppool_t* pool, zerolist_pcell_t* cell)
+{
+    if (!pool || !cell) return NULL;
+
+    for (;;) {
+        zerolist_pnode_t* ver = __atomic_load_n(&cell->ver, __ATOMIC_ACQUIRE);
+        if (!ver) return NULL;
+
+        // 节点内存来自静态池、始终有效：只在计数非 0 时加引用，随后确认单元仍指向它
+        uint32_t refs = __atomic_load_n(&ver->refs, __ATOMIC_RELAXED);
+        bool     got  = false;
+        while (refs != 0) {
+            if (__atomic_compare_exchange_n(&ver->refs, &refs, refs + 1, true, __ATOMIC_ACQUIRE,
+                                            __ATOMIC_RELAXED)) {
+                got = true;
+                break;
+            }
+        }
+        if (!got) continue;
+        if (__atomic_load_n(&cell->ver, __ATOMIC_ACQUIRE) == ver) return ver;
+        zerolist_pver_release(pool, ver);
+    }
+}
+#endif  // ZEROLIST_PERSISTENT_ENABLE
+
+#if ZEROLIST_SHARD_ENABLE
+// ===========================================
+// 分片链表
+// ===========================================
+
+// drain 每次在锁内摘取的最大节点数
+#define _ZEROLIST_SHARD_BATCH 32
+// 自旋多少次后让出 CPU（持锁线程可能被抢占，线程数多于核数时尤为明显）
+#define _ZEROLIST_SHARD_SPINS 64
+
+static inline void _zerolist_shard_lock(zerolist_shard_t* shard)
+{
+    while (__atomic_test_and_set(&shard->lock, __ATOMIC_ACQUIRE)) {
+        uint32_t spins = 0;
+        while (__atomic_load_n(&shard->lock, __ATOMIC_RELAXED)) {
+            if (++spins >= _ZEROLIST_SHARD_SPINS) {
+                sched_yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+static inline void _zerolist_shard_unlock(zerolist_shard_t* shard)
+{
+    __atomic_clear(&shard->lock, __ATOMIC_RELEASE);
+}
+
+bool zerolist_sharded_init(zerolist_sharded_t* sharded)
+{
+    if (!sharded || !sharded->shards || sharded->count == 0 || sharded->nodes_per_shard == 0) {
+        return false;
+    }
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    if (!sharded->bufs) return false;
+#if ZEROLIST_FAST_ALLOC
+    if (!sharded->stacks) return false;
+#endif
+#endif
+
+    ZEROLIST_TYPE n = sharded->nodes_per_shard;
+    for (uint32_t i = 0; i < sharded->count; i++) {
+        zerolist_shard_t* shard = &sharded->shards[i];
+        memset(&shard->list, 0, sizeof(shard->list));
+        shard->lock = 0;
+#if ZEROLIST_USE_MALLOC
+        bool ok = list_init_dynamic(&shard->list);
+        (void)n;
+#elif ZEROLIST_STATIC_DYNAMIC_EXPAND
+        bool ok = list_init_dynamic_expand(&shard->list, n);
+#else
+        zerolist_init_expand(&shard->list, &sharded->bufs[(size_t)i * n],
+#if ZEROLIST_FAST_ALLOC
+                             &sharded->stacks[(size_t)i * n],
+#endif
+                             n);
+        bool ok = true;
+#endif
+        if (!ok) {
+            while (i--) {
+                zerolist_destroy(&sharded->shards[i].list);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+void zerolist_sharded_destroy(zerolist_sharded_t* sharded)
+{
+    if (!sharded || !sharded->shards) return;
+    for (uint32_t i = 0; i < sharded->count; i++) {
+        zerolist_shard_t* shard = &sharded->shards[i];
+        _zerolist_shard_lock(shard);
+        zerolist_destroy(&shard->list);
+        _zerolist_shard_unlock(shard);
+    }
+}
+
+uint32_t zerolist_sharded_local(const zerolist_sharded_t* sharded)
+{
+    static uint32_t          next_ticket;
+    static __thread uint32_t ticket;  // 0 表示本线程尚未分配
+
+    if (!sharded || sharded->count == 0) return 0;
+    if (!ticket) ticket = __atomic_add_fetch(&next_ticket, 1, __ATOMIC_RELAXED);
+    return (ticket - 1) % sharded->count;
+}
+
+bool zerolist_sharded_push_back(zerolist_sharded_t* sharded, uint32_t shard, void* data)
+{
+    if (!sharded || !sharded->shards || sharded->count == 0) return false;
+
+    zerolist_shard_t* s = &sharded->shards[shard % sharded->count];
+    _zerolist_shard_lock(s);
+    bool ok = zerolist_push_back(&s->list, data);
+    _zerolist_shard_unlock(s);
+    return ok;
+}
+
+size_t zerolist_sharded_size(zerolist_sharded_t* sharded)
+{
+    if (!sharded || !sharded->shards) return 0;
+
+    size_t total = 0;
+    for (uint32_t i = 0; i < sharded->count; i++) {
+        zerolist_shard_t* s = &sharded->shards[i];
+        _zerolist_shard_lock(s);
+        total += zerolist_size(&s->list);
+        _zerolist_shard_unlock(s);
+    }
+    return total;
+}
+
+void zerolist_sharded_foreach(zerolist_sharded_t* sharded, void (*callback)(void* data))
+{
+    if (!sharded || !sharded->shards || !callback) return;
+
+    for (uint32_t i = 0; i < sharded->count; i++) {
+        zerolist_shard_t* s = &sharded->shards[i];
+        _zerolist_shard_lock(s);
+        zerolist_foreach(&s->list, callback);
+        _zerolist_shard_unlock(s);
+    }
+}
+
+size_t zerolist_sharded_drain(zerolist_sharded_t* sharded, void (*fn)(void* data, void* ctx),
+                              void* ctx)
+{
+    if (!sharded || !sharded->shards || !fn) return 0;
+
+    size_t total = 0;
+    void*  batch[_ZEROLIST_SHARD_BATCH];
+    for (uint32_t i = 0; i < sharded->count; i++) {
+        zerolist_shard_t* s = &sharded->shards[i];
+        for (;;) {
+            uint32_t n = 0;
+            _zerolist_shard_lock(s);
+            while (n < _ZEROLIST_SHARD_BATCH && s->list.head) {
+                batch[n++] = zerolist_pop_front(&s->list);
+            }
+            _zerolist_shard_unlock(s);
+
+            for (uint32_t k = 0; k < n; k++) {
+                fn(batch[k], ctx);
+            }
+            total += n;
+            if (n < _ZEROLIST_SHARD_BATCH) break;
+        }
+    }
+    return total;
+}
+#endif  // ZEROLIST_SHARD_ENABLE
+
+#if ZEROLIST_WSDEQUE_ENABLE
+// ===========================================
+// 工作窃取双端队列（Chase–Lev）
+// ===========================================
+
+// 缓冲区满时能否向内存池申请更大的环
+#define _ZEROLIST_WSDEQUE_CAN_GROW \
+    (ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC || ZEROLIST_STATIC_DYNAMIC_EXPAND)
+
+bool zerolist_wsdeque_init(zerolist_wsdeque_t* deque, void** slots, size_t capacity)
+{
+    if (!deque || capacity < 2 || (capacity & (capacity - 1))) return false;
+
+    memset(deque, 0, sizeof(*deque));
+    if (!slots) {
+#if _ZEROLIST_WSDEQUE_CAN_GROW
+        slots = (void**)ZEROLIST_MALLOC(capacity * sizeof(void*));
+        if (!slots) return false;
+        deque->own_slots = 1;
+#else
+        return false;
+#endif
+    }
+    deque->initial.slot = slots;
+    deque->initial.mask = capacity - 1;
+    deque->buf          = &deque->initial;
+    return true;
+}
+
+void zerolist_wsdeque_destroy(zerolist_wsdeque_t* deque)
+{
+    if (!deque || !deque->buf) return;
+
+    zerolist_wsbuf_t* buf = deque->buf;
+    while (buf && buf != &deque->initial) {
+        zerolist_wsbuf_t* retired = buf->retired;
+        ZEROLIST_FREE(buf);
+        buf = retired;
+    }
+    if (deque->own_slots) ZEROLIST_FREE(deque->initial.slot);
+    memset(deque, 0, sizeof(*deque));
+}
+
+#if _ZEROLIST_WSDEQUE_CAN_GROW
+/**
+ * @brief 把 [top, bottom) 复制到容量翻倍的新环（只由所有者调用）
+ *
+ * 旧环挂在新环的 retired 上，不立即释放：窃取者可能已读到旧的 buf 指针。
+ */
+static zerolist_wsbuf_t* _zerolist_wsdeque_grow(zerolist_wsdeque_t* deque, zerolist_wsbuf_t* old,
+                                                int64_t top, int64_t bottom)
+{
+    size_t capacity = (old->mask + 1) << 1;
+    if (capacity <= old->mask + 1) return NULL;
+
+    zerolist_wsbuf_t* buf =
+        (zerolist_wsbuf_t*)ZEROLIST_MALLOC(sizeof(zerolist_wsbuf_t) + capacity * sizeof(void*));
+    if (!buf) return NULL;
+    buf->slot    = (void**)(buf + 1);
+    buf->mask    = capacity - 1;
+    buf->retired = old;
+    for (int64_t i = top; i < bottom; i++) {
+        buf->slot[(size_t)i & buf->mask] =
+            __atomic_load_n(&old->slot[(size_t)i & old->mask], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&deque->buf, buf, __ATOMIC_RELEASE);
+    return buf;
+}
+#endif
+
+bool zerolist_wsdeque_push(zerolist_wsdeque_t* deque, void* task)
+{
+    if (!deque || !deque->buf || !task) return false;
+
+    int64_t           b   = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    int64_t           t   = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    zerolist_wsbuf_t* buf = deque->buf;
+    if (b - t > (int64_t)buf->mask) {
+#if _ZEROLIST_WSDEQUE_CAN_GROW
+        buf = _zerolist_wsdeque_grow(deque, buf, t, b);
+        if (!buf) return false;
+#else
+        return false;
+#endif
+    }
+    __atomic_store_n(&buf->slot[(size_t)b & buf->mask], task, __ATOMIC_RELAXED);
+    __atomic_store_n(&deque->bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void* zerolist_wsdeque_pop(zerolist_wsdeque_t* deque)
+{
+    if (!deque || !deque->buf) return NULL;
+
+    int64_t           b   = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+    zerolist_wsbuf_t* buf = deque->buf;
+    __atomic_store_n(&deque->bottom, b, __ATOMIC_RELAXED);
+    // 先公布 bottom 再读 top，与 steal 中的栅栏配对，保证两端不会取到同一个任务
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t t = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+    if (t > b) {
+        __atomic_store_n(&deque->bottom, b + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    void* task = __atomic_load_n(&buf->slot[(size_t)b & buf->mask], __ATOMIC_RELAXED);
+    if (t == b) {
+        // 最后一个任务：与窃取者竞争 top
+        if (!__atomic_compare_exchange_n(&deque->top, &t, t + 1, false, __ATOMIC_SEQ_CST,
+                                         __ATOMIC_RELAXED)) {
+            task = NULL;
+        }
+        __atomic_store_n(&deque->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return task;
+}
+
+void* zerolist_wsdeque_steal(zerolist_wsdeque_t* deque)
+{
+    if (!deque) return NULL;
+
+    int64_t t = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t b = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+    if (t >= b) return NULL;
+
+    zerolist_wsbuf_t* buf  = __atomic_load_n(&deque->buf, __ATOMIC_ACQUIRE);
+    void*             task = __atomic_load_n(&buf->slot[(size_t)t & buf->mask], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&deque->top, &t, t + 1, false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_RELAXED)) {
+        return NULL;
+    }
+    return task;
+}
+
+size_t zerolist_wsdeque_size(const zerolist_wsdeque_t* deque)
+{
+    if (!deque) return 0;
+
+    int64_t b = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    int64_t t = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+    return b > t ? (size_t)(b - t) : 0;
+}
+#endif  // ZEROLIST_WSDEQUE_ENABLE
+
+#if ZEROLIST_CHAN_ENABLE
+// ===========================================
+// 对象回收通道
+// ===========================================
+
+static inline void _zerolist_cqueue_push(zerolist_cqueue_t* queue, zerolist_cnode_t* node)
+{
+    node->next = NULL;
+    if (queue->tail) {
+        queue->tail->next = node;
+    } else {
+        queue->head = node;
+    }
+    queue->tail = node;
+    queue->count++;
+}
+
+static inline zerolist_cnode_t* _zerolist_cqueue_pop(zerolist_cqueue_t* queue)
+{
+    zerolist_cnode_t* node = queue->head;
+    if (!node) return NULL;
+    queue->head = node->next;
+    if (!queue->head) queue->tail = NULL;
+    queue->count--;
+    node->next = NULL;
+    return node;
+}
+
+// 把 src 整条接到 dst 尾部并清空 src
+static inline void _zerolist_cqueue_splice(zerolist_cqueue_t* dst, zerolist_cqueue_t* src)
+{
+    if (!src->head) return;
+    if (dst->tail) {
+        dst->tail->next = src->head;
+    } else {
+        dst->head = src->head;
+    }
+    dst->tail  = src->tail;
+    dst->count += src->count;
+    src->head  = NULL;
+    src->tail  = NULL;
+    src->count = 0;
+}
+
+bool zerolist_chan_init(zerolist_chan_t* chan, zerolist_cnode_t* nodes, size_t count,
+                        void* buffers, size_t buf_size)
+{
+    if (!chan || !nodes || count == 0) return false;
+    if (buffers && buf_size == 0) return false;
+
+    memset(chan, 0, sizeof(*chan));
+    chan->node_buf  = nodes;
+    chan->max_nodes = count;
+    for (size_t i = 0; i < count; i++) {
+        zerolist_cnode_t* node = &nodes[i];
+        if (buffers) node->data = (uint8_t*)buffers + i * buf_size;
+        node->len = 0;
+        _zerolist_cqueue_push(&chan->free, node);
+    }
+    return true;
+}
+
+zerolist_cnode_t* zerolist_chan_acquire(zerolist_chan_t* chan)
+{
+    if (!chan) return NULL;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    zerolist_cnode_t* node = _zerolist_cqueue_pop(&chan->free);
+    ZEROLIST_CHAN_UNLOCK(chan);
+    if (node) node->len = 0;
+    return node;
+}
+
+void zerolist_chan_submit(zerolist_chan_t* chan, zerolist_cnode_t* node)
+{
+    if (!chan || !node) return;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    _zerolist_cqueue_push(&chan->ready, node);
+    ZEROLIST_CHAN_UNLOCK(chan);
+}
+
+zerolist_cnode_t* zerolist_chan_receive(zerolist_chan_t* chan)
+{
+    if (!chan) return NULL;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    zerolist_cnode_t* node = _zerolist_cqueue_pop(&chan->ready);
+    ZEROLIST_CHAN_UNLOCK(chan);
+    return node;
+}
+
+void zerolist_chan_recycle(zerolist_chan_t* chan, zerolist_cnode_t* node)
+{
+    if (!chan || !node) return;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    _zerolist_cqueue_push(&chan->free, node);
+    ZEROLIST_CHAN_UNLOCK(chan);
+}
+
+size_t zerolist_chan_acquire_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch, size_t max)
+{
+    if (!chan || !batch || max == 0) return 0;
+
+    zerolist_cqueue_t taken = { 0 };
+    ZEROLIST_CHAN_LOCK(chan);
+    if (max >= chan->free.count) {
+        _zerolist_cqueue_splice(&taken, &chan->free);
+    } else {
+        // 只摘取前 max 个节点：沿链走到切分点后整段断开
+        zerolist_cnode_t* last = chan->free.head;
+        for (size_t i = 1; i < max; i++) {
+            last = last->next;
+        }
+        taken.head       = chan->free.head;
+        taken.tail       = last;
+        taken.count      = max;
+        chan->free.head  = last->next;
+        chan->free.count -= max;
+        last->next       = NULL;
+    }
+    ZEROLIST_CHAN_UNLOCK(chan);
+
+    ZEROLIST_CQUEUE_FOR_EACH(&taken, node) {
+        node->len = 0;
+    }
+    size_t n = taken.count;
+    _zerolist_cqueue_splice(batch, &taken);
+    return n;
+}
+
+void zerolist_chan_submit_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch)
+{
+    if (!chan || !batch) return;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    _zerolist_cqueue_splice(&chan->ready, batch);
+    ZEROLIST_CHAN_UNLOCK(chan);
+}
+
+size_t zerolist_chan_receive_all(zerolist_chan_t* chan, zerolist_cqueue_t* batch)
+{
+    if (!chan || !batch) return 0;
+
+    zerolist_cqueue_t taken = { 0 };
+    ZEROLIST_CHAN_LOCK(chan);
+    _zerolist_cqueue_splice(&taken, &chan->ready);
+    ZEROLIST_CHAN_UNLOCK(chan);
+
+    size_t n = taken.count;
+    _zerolist_cqueue_splice(batch, &taken);
+    return n;
+}
+
+void zerolist_chan_recycle_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch)
+{
+    if (!chan || !batch) return;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    _zerolist_cqueue_splice(&chan->free, batch);
+    ZEROLIST_CHAN_UNLOCK(chan);
+}
+
+zerolist_cnode_t* zerolist_cqueue_pop(zerolist_cqueue_t* batch)
+{
+    return batch ? _zerolist_cqueue_pop(batch) : NULL;
+}
+
+size_t zerolist_chan_free_count(zerolist_chan_t* chan)
+{
+    if (!chan) return 0;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    size_t n = chan->free.count;
+    ZEROLIST_CHAN_UNLOCK(chan);
+    return n;
+}
+
+size_t zerolist_chan_ready_count(zerolist_chan_t* chan)
+{
+    if (!chan) return 0;
+
+    ZEROLIST_CHAN_LOCK(chan);
+    size_t n = chan->ready.count;
+    ZEROLIST_CHAN_UNLOCK(chan);
+    return n;
 }
+#endif  // ZEROLIST_CHAN_ENABLE
@@ -44,6 +44,9 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
+#if defined(ZEROLIST_BUFCHAIN_ENABLE) && ZEROLIST_BUFCHAIN_ENABLE
+#include <sys/uio.h>  // struct iovec
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -144,6 +147,219 @@ extern "C" {
 #define ZEROLIST_REALLOC(ptr, size) (realloc(ptr, size))
 #endif
 
+// ===========================================
+// 【扩展功能】可选配置（默认全部关闭）
+// ===========================================
+
+/// @brief 跨进程共享内存链表（仅 POSIX）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_shm_* 接口：链表头、节点与负载全部位于 shm_open/mmap 区域，
+///       节点之间使用下标链接，分配与链接由进程共享的鲁棒互斥锁保护
+/// @warning 启用后需链接 pthread（部分平台还需要 -lrt）
+#ifndef ZEROLIST_SHM_ENABLE
+#define ZEROLIST_SHM_ENABLE 0
+#endif
+
+/// @brief 静态池脏槽位跟踪与增量检查点
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：每个槽位 1 bit 脏标记，zerolist_checkpoint_delta() 只输出上次检查点后
+///       变化过的槽位，zerolist_apply_delta() 将其应用到副本
+/// @warning 仅支持静态模式（含动态扩容），与 ZEROLIST_STATIC_FALLBACK_MALLOC 互斥
+#ifndef ZEROLIST_DIRTY_TRACK
+#define ZEROLIST_DIRTY_TRACK 0
+#endif
+
+/// @brief O(1) 惰性反转
+/// @note 0 = 禁用（默认，zerolist_reverse 逐节点交换 prev/next）
+/// @note 1 = 启用：Zerolist 携带方向标志，zerolist_reverse 只翻转标志，
+///       所有操作与遍历宏按标志解释 prev/next
+/// @warning 启用后直接访问 node->next/node->prev 得到的是物理方向，
+///          逻辑遍历请使用 ZEROLIST_NODE_NEXT/ZEROLIST_NODE_PREV
+#ifndef ZEROLIST_LAZY_REVERSE
+#define ZEROLIST_LAZY_REVERSE 0
+#endif
+
+/// @brief 零拷贝子链表视图
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_view_* 接口，Zerolist 增加结构修改计数用于视图有效性检查
+#ifndef ZEROLIST_VIEW_ENABLE
+#define ZEROLIST_VIEW_ENABLE 0
+#endif
+
+/// @brief 分散/聚集缓冲区链模式
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：节点额外携带缓冲区长度 len 与已发送偏移 off，提供
+///       zerolist_to_iovec() 零拷贝导出给 writev/sendmsg，以及 zerolist_consume() 按字节出队
+/// @warning 依赖 POSIX <sys/uio.h> 中的 struct iovec
+#ifndef ZEROLIST_BUFCHAIN_ENABLE
+#define ZEROLIST_BUFCHAIN_ENABLE 0
+#endif
+
+/// @brief 增量维护的聚合值（幺半群汇总）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：可为链表设置 zerolist_monoid_t，插入/删除时增量更新汇总值，
+///       zerolist_aggregate() 通常无需遍历（各操作的代价见 zerolist_set_monoid）
+#ifndef ZEROLIST_AGGREGATE_ENABLE
+#define ZEROLIST_AGGREGATE_ENABLE 0
+#endif
+
+/// @brief 自组织查找
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：可为链表设置命中后的调整策略（移到表头 / 与前驱交换 / 按命中计数排序），
+///       zerolist_search 从头按链表顺序查找并统计探测深度；zerolist_find 只在策略不为
+///       ZEROLIST_SEARCH_NONE 时这样做，否则仍走成员索引/静态池扫描等快速路径
+#ifndef ZEROLIST_SELF_ORGANIZE
+#define ZEROLIST_SELF_ORGANIZE 0
+#endif
+
+/// @brief 节点内联键指纹
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：可为链表设置键提取函数，插入时把键写入节点，
+///       zerolist_search_key() 先比较节点内的键，只在键相等时才调用比较函数（解引用 data）
+#ifndef ZEROLIST_KEY_ENABLE
+#define ZEROLIST_KEY_ENABLE 0
+#endif
+
+/// @brief 键指纹类型（仅 ZEROLIST_KEY_ENABLE 时使用）
+#ifndef ZEROLIST_KEY_TYPE
+#define ZEROLIST_KEY_TYPE uint32_t
+#endif
+
+/// @brief 计数布隆过滤器（快速否定成员查询）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：按节点数据指针维护 8 位饱和计数器，插入/删除时更新，
+///       zerolist_find/zerolist_remove_ptr 在扫描前先排除“必定不存在”的指针
+#ifndef ZEROLIST_BLOOM_ENABLE
+#define ZEROLIST_BLOOM_ENABLE 0
+#endif
+
+/// @brief 每个节点对应的计数器个数（过滤器大小 = max_nodes × 该值）
+#ifndef ZEROLIST_BLOOM_RATIO
+#define ZEROLIST_BLOOM_RATIO 8
+#endif
+
+/// @brief 每个指针映射的计数器个数（哈希函数个数）
+#ifndef ZEROLIST_BLOOM_HASHES
+#define ZEROLIST_BLOOM_HASHES 4
+#endif
+
+/// @brief 去重合并队列（集合语义的成员索引）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：按数据指针维护链式哈希索引，zerolist_push_back_unique() 对已在队列中的
+///       指针 O(1) 合并（忽略或移到队尾），zerolist_find/zerolist_remove_ptr 也经索引定位
+#ifndef ZEROLIST_UNIQUE_ENABLE
+#define ZEROLIST_UNIQUE_ENABLE 0
+#endif
+
+/// @brief 顺序维护标签（O(1) 判断两个节点的先后）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用：节点携带 32 位标签，插入时取前后标签的中点，间隙用尽时局部重标号，
+///       zerolist_precedes()/zerolist_order_compare() 无需遍历即可比较位置
+#ifndef ZEROLIST_ORDER_ENABLE
+#define ZEROLIST_ORDER_ENABLE 0
+#endif
+
+/// @brief 多链表成员节点（一个负载同时挂在多条链表上）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_mpool_* / zerolist_mlist_* 接口：一次分配的节点携带
+///       ZEROLIST_MULTI_LINKS 组前后链接，zerolist_mnode_release() O(K) 从所有链表摘除并归还
+#ifndef ZEROLIST_MULTI_ENABLE
+#define ZEROLIST_MULTI_ENABLE 0
+#endif
+
+/// @brief 多链表节点的链接组数（同一节点最多同时所在的链表数，1~32）
+#ifndef ZEROLIST_MULTI_LINKS
+#define ZEROLIST_MULTI_LINKS 4
+#endif
+
+/// @brief 持久化（不可变）链表版本
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_ppool_* / zerolist_pver_* / zerolist_pcell_* 接口：版本之间共享尾部，
+///       头插 O(1) 生成新版本，节点引用计数归零时回收到静态节点池；读者无锁持有版本
+/// @warning 依赖 GCC/Clang 的 __atomic 内建函数，节点池空闲链使用 64 位 CAS
+#ifndef ZEROLIST_PERSISTENT_ENABLE
+#define ZEROLIST_PERSISTENT_ENABLE 0
+#endif
+
+/// @brief 分片链表（多核并发追加）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_sharded_* 接口：每个分片是一条带独立节点池的 Zerolist，
+///       各占独立缓存行并由自旋锁保护；生产者只追加到本地分片，汇总操作逐个分片合并
+/// @warning 依赖 GCC/Clang 的 __atomic 内建函数、__thread 与 POSIX sched_yield()
+#ifndef ZEROLIST_SHARD_ENABLE
+#define ZEROLIST_SHARD_ENABLE 0
+#endif
+
+/// @brief 工作窃取双端队列（Chase–Lev）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_wsdeque_* 接口：所有者在底端无锁压入/弹出，窃取者在顶端 CAS 取走任务；
+///       可 malloc 的模式下环形缓冲区满时自动翻倍，纯静态模式下容量固定
+/// @warning 依赖 GCC/Clang 的 __atomic 内建函数
+#ifndef ZEROLIST_WSDEQUE_ENABLE
+#define ZEROLIST_WSDEQUE_ENABLE 0
+#endif
+
+/// @brief 中断安全的延迟修改日志
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_defer / zerolist_apply_pending：中断里 O(1) 无锁记录 push/remove/move，
+///       任务上下文中一次遍历批量应用，中断无需关闭也无需遍历链表
+/// @warning 依赖 GCC/Clang 的 __atomic 内建函数，目标需支持 32 位 CAS（如 Cortex-M3 及以上）
+#ifndef ZEROLIST_DEFER_ENABLE
+#define ZEROLIST_DEFER_ENABLE 0
+#endif
+
+/// @brief 延迟修改日志的槽位数（2 的幂），也是一次 zerolist_apply_pending 的最大批量
+#ifndef ZEROLIST_DEFER_SLOTS
+#define ZEROLIST_DEFER_SLOTS 16
+#endif
+
+/// @brief 对象回收通道（空闲链 + 就绪队列）
+/// @note 0 = 禁用（默认）
+/// @note 1 = 启用 zerolist_chan_* 接口：每个节点携带一块预分配缓冲区，缓冲区在空闲/就绪两种状态间
+///       流转时只重新链接节点，每条消息零分配，并支持整批移动
+#ifndef ZEROLIST_CHAN_ENABLE
+#define ZEROLIST_CHAN_ENABLE 0
+#endif
+
+/// @brief 通道加锁/解锁钩子（默认为空，单上下文使用）
+/// @note 生产者与消费者位于不同线程或中断时，可映射为互斥锁或开关中断；临界区内只做 O(1) 链接操作
+/// @example #define ZEROLIST_CHAN_LOCK(chan)   __disable_irq()
+#ifndef ZEROLIST_CHAN_LOCK
+#define ZEROLIST_CHAN_LOCK(chan) ((void)(chan))
+#endif
+#ifndef ZEROLIST_CHAN_UNLOCK
+#define ZEROLIST_CHAN_UNLOCK(chan) ((void)(chan))
+#endif
+
+/// @brief 缓存行大小（字节），用于分片之间、双端队列两端的填充对齐
+#ifndef ZEROLIST_CACHE_LINE
+#define ZEROLIST_CACHE_LINE 64
+#endif
+
+/// @brief zerolist_random() 在静态池中随机探测槽位的最大次数
+/// @note 探测全部落空（或装载率过低）时退化为按随机下标遍历
+#ifndef ZEROLIST_RANDOM_PROBES
+#define ZEROLIST_RANDOM_PROBES 8
+#endif
+
+/// @brief zerolist_merge_k() 一次最多合并的链表数（堆位于栈上）
+#ifndef ZEROLIST_MERGE_K_MAX
+#define ZEROLIST_MERGE_K_MAX 16
+#endif
+
+/// @brief zerolist_unique() 栈上哈希桶数（2 的幂）
+/// @note 纯静态模式（无 malloc）下桶数固定为此值，长度为 n 的链表期望比较约 n²/(2×桶数) 次；
+///       可 malloc 的模式按链表长度分配桶数组，仅在分配失败时退回此值。
+///       栈占用为 桶数 × sizeof(void*)，长链表去重时可按 max_nodes 调大
+#ifndef ZEROLIST_DEDUP_STACK_BUCKETS
+#define ZEROLIST_DEDUP_STACK_BUCKETS 64
+#endif
+
+/// @brief 聚合值类型（仅 ZEROLIST_AGGREGATE_ENABLE 时使用）
+#ifndef ZEROLIST_AGG_TYPE
+#define ZEROLIST_AGG_TYPE int64_t
+#endif
+
 // ===========================================
 // 模式互斥检查
 // ===========================================
@@ -164,6 +380,40 @@ extern "C" {
     "ZEROLIST_STATIC_FALLBACK_MALLOC are mutually exclusive."
 #endif
 
+#if (ZEROLIST_DIRTY_TRACK && (ZEROLIST_USE_MALLOC || ZEROLIST_STATIC_FALLBACK_MALLOC))
+#error "[zerolist error] Invalid config: ZEROLIST_DIRTY_TRACK requires a pure static node pool."
+#endif
+
+#if (ZEROLIST_SHARD_ENABLE && !defined(__GNUC__))
+#error "[zerolist error] Invalid config: ZEROLIST_SHARD_ENABLE requires __atomic builtins."
+#endif
+
+#if (ZEROLIST_WSDEQUE_ENABLE && !defined(__GNUC__))
+#error "[zerolist error] Invalid config: ZEROLIST_WSDEQUE_ENABLE requires __atomic builtins."
+#endif
+
+#if (ZEROLIST_DEFER_ENABLE && !defined(__GNUC__))
+#error "[zerolist error] Invalid config: ZEROLIST_DEFER_ENABLE requires __atomic builtins."
+#endif
+
+#if (ZEROLIST_DEFER_ENABLE                                                                     \
+     && (ZEROLIST_DEFER_SLOTS < 2 || (ZEROLIST_DEFER_SLOTS & (ZEROLIST_DEFER_SLOTS - 1))))
+#error "[zerolist error] Invalid config: ZEROLIST_DEFER_SLOTS must be a power of two."
+#endif
+
+#if (ZEROLIST_PERSISTENT_ENABLE && !defined(__GNUC__))
+#error "[zerolist error] Invalid config: ZEROLIST_PERSISTENT_ENABLE requires __atomic builtins."
+#endif
+
+#if (ZEROLIST_DEDUP_STACK_BUCKETS < 1                                                         \
+     || (ZEROLIST_DEDUP_STACK_BUCKETS & (ZEROLIST_DEDUP_STACK_BUCKETS - 1)))
+#error "[zerolist error] Invalid config: ZEROLIST_DEDUP_STACK_BUCKETS must be a power of two."
+#endif
+
+#if (ZEROLIST_MULTI_ENABLE && (ZEROLIST_MULTI_LINKS < 1 || ZEROLIST_MULTI_LINKS > 32))
+#error "[zerolist error] Invalid config: ZEROLIST_MULTI_LINKS must be between 1 and 32."
+#endif
+
 // ===========================================
 // 数据结构定义
 // ===========================================
@@ -179,6 +429,25 @@ typedef struct zerolist_node
     void*                 data;  ///< 节点数据指针，指向用户数据
     struct zerolist_node* prev;  ///< 前驱节点指针
     struct zerolist_node* next;  ///< 后继节点指针
+#if ZEROLIST_BUFCHAIN_ENABLE
+    size_t len;  ///< 缓冲区长度（字节）
+    size_t off;  ///< 已消费的字节数，off < len 的部分为待发送数据
+#endif
+#if ZEROLIST_SELF_ORGANIZE
+    uint32_t hits;  ///< 查找命中次数（ZEROLIST_SEARCH_COUNT 策略使用）
+#endif
+#if ZEROLIST_KEY_ENABLE
+    ZEROLIST_KEY_TYPE key;  ///< 键指纹（由链表的键提取函数在插入时写入）
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    struct zerolist_node* hnext;  ///< 成员索引桶内的下一个节点
+#endif
+#if ZEROLIST_ORDER_ENABLE
+    uint32_t label;  ///< 顺序标签，沿 next 方向循环递增
+#endif
+#if ZEROLIST_AGGREGATE_ENABLE
+    ZEROLIST_AGG_TYPE agg;  ///< 双栈汇总前段中，本节点到前段末尾的后缀汇总
+#endif
 #if !ZEROLIST_USE_MALLOC
     struct
     {
@@ -189,6 +458,88 @@ typedef struct zerolist_node
 #endif
 } zerolist_node_t;
 
+#if ZEROLIST_AGGREGATE_ENABLE
+/**
+ * @struct zerolist_monoid
+ * @brief 用户提供的幺半群，描述如何把节点数据汇总为一个值
+ *
+ * 例如队列字节数：identity = 0，combine = 加法，extract 取负载长度，uncombine = 减法；
+ * 最大截止时间：identity = INT64_MIN，combine = max，uncombine 为 NULL（按双栈维护，
+ * 每个节点额外保存一个后缀汇总值）。
+ */
+typedef struct zerolist_monoid
+{
+    /// 单位元（空链表的汇总值）
+    ZEROLIST_AGG_TYPE identity;
+    /// 结合运算 a·b
+    ZEROLIST_AGG_TYPE (*combine)(ZEROLIST_AGG_TYPE a, ZEROLIST_AGG_TYPE b);
+    /// 从节点数据取值
+    ZEROLIST_AGG_TYPE (*extract)(const void* data);
+    /// 逆运算，从 acc 中去掉 v（可为 NULL）
+    ZEROLIST_AGG_TYPE (*uncombine)(ZEROLIST_AGG_TYPE acc, ZEROLIST_AGG_TYPE v);
+    /// combine 是否可交换；可交换时中间插入与任意位置删除也能 O(1) 更新
+    bool commutative;
+} zerolist_monoid_t;
+#endif
+
+#if ZEROLIST_SELF_ORGANIZE
+/// @name 自组织查找策略
+/// @{
+#define ZEROLIST_SEARCH_NONE          0  ///< 不调整
+#define ZEROLIST_SEARCH_MOVE_TO_FRONT 1  ///< 命中节点移到表头
+#define ZEROLIST_SEARCH_TRANSPOSE     2  ///< 命中节点与逻辑前驱交换
+#define ZEROLIST_SEARCH_COUNT         3  ///< 命中计数加一，并前移到计数不小于它的节点之后
+/// @}
+
+/**
+ * @struct zerolist_search_stats
+ * @brief 查找统计，平均探测深度 = probes / searches
+ */
+typedef struct zerolist_search_stats
+{
+    uint32_t searches;  ///< 查找次数
+    uint32_t found;     ///< 命中次数
+    uint64_t probes;    ///< 累计比较的节点数
+} zerolist_search_stats_t;
+#endif
+
+#if ZEROLIST_DEFER_ENABLE
+/**
+ * @enum zerolist_defer_op
+ * @brief 延迟修改操作
+ */
+typedef enum zerolist_defer_op
+{
+    ZEROLIST_DEFER_PUSH_BACK,   ///< 追加到队尾
+    ZEROLIST_DEFER_PUSH_FRONT,  ///< 插入到表头
+    ZEROLIST_DEFER_REMOVE,      ///< 删除第一个数据为 data 的节点
+    ZEROLIST_DEFER_MOVE_FRONT,  ///< 把第一个数据为 data 的节点移到表头
+    ZEROLIST_DEFER_MOVE_BACK,   ///< 把第一个数据为 data 的节点移到队尾
+} zerolist_defer_op_t;
+
+/**
+ * @struct zerolist_defer_entry
+ * @brief 日志槽位，seq 减去槽位下标后表示槽位状态（全零即初始可写）
+ */
+typedef struct zerolist_defer_entry
+{
+    uint32_t seq;   ///< 序号（写入完成 / 已消费）
+    uint8_t  op;    ///< zerolist_defer_op_t
+    void*    data;  ///< 操作数据
+} zerolist_defer_entry_t;
+
+/**
+ * @struct zerolist_defer_log
+ * @brief 多生产者（中断）单消费者（任务）有界环形日志
+ */
+typedef struct zerolist_defer_log
+{
+    uint32_t               enq;                          ///< 生产者位置（CAS 推进）
+    uint32_t               deq;                          ///< 消费者位置
+    zerolist_defer_entry_t entry[ZEROLIST_DEFER_SLOTS];  ///< 槽位
+} zerolist_defer_log_t;
+#endif
+
 /**
  * @struct Zerolist
  * @brief 链表结构体
@@ -200,7 +551,44 @@ typedef struct Zerolist
 #if ZEROLIST_SIZE_ENABLE
     ZEROLIST_TYPE size;  ///< 当前链表中的节点数量
 #endif
-    zerolist_node_t* head;  ///< 链表头节点指针
+    zerolist_node_t* head;     ///< 链表头节点指针
+    zerolist_node_t* reclaim;  ///< 已脱离链表、等待分步回收的节点环（见 zerolist_clear_step）
+#if ZEROLIST_LAZY_REVERSE
+    uint8_t reversed;  ///< 方向标志，1 表示逻辑顺序沿 prev 方向
+#endif
+#if ZEROLIST_VIEW_ENABLE
+    uint32_t mod_count;  ///< 结构修改计数，插入/删除/反转/扩容/（重新）初始化时递增
+#endif
+#if ZEROLIST_AGGREGATE_ENABLE
+    const zerolist_monoid_t* monoid;     ///< 汇总使用的幺半群（NULL 表示未启用）
+    ZEROLIST_AGG_TYPE        agg;        ///< 汇总值（双栈模式下为后段的汇总）
+    ZEROLIST_TYPE            agg_front;  ///< 双栈模式下前段的节点数
+    uint8_t                  agg_stale;  ///< 汇总值已失效，下次查询时重新计算
+#endif
+#if ZEROLIST_BLOOM_ENABLE
+    uint8_t* bloom;        ///< 计数布隆过滤器（NULL 表示未启用）
+    size_t   bloom_slots;  ///< 计数器个数
+#if ZEROLIST_USE_MALLOC
+    size_t bloom_items;  ///< 过滤器中的元素数（决定何时扩大）
+#endif
+#endif
+#if ZEROLIST_UNIQUE_ENABLE
+    zerolist_node_t** index;        ///< 成员索引桶数组（NULL 表示未启用）
+    size_t            index_slots;  ///< 桶个数
+#if ZEROLIST_USE_MALLOC
+    size_t index_items;  ///< 索引中的节点数（决定何时加倍桶数）
+#endif
+#endif
+#if ZEROLIST_SELF_ORGANIZE
+    uint8_t                 search_policy;  ///< 自组织查找策略（ZEROLIST_SEARCH_*）
+    zerolist_search_stats_t search_stats;   ///< 查找统计
+#endif
+#if ZEROLIST_KEY_ENABLE
+    ZEROLIST_KEY_TYPE (*key_func)(const void* data);  ///< 键提取函数（NULL 表示未启用）
+#endif
+#if ZEROLIST_DEFER_ENABLE
+    zerolist_defer_log_t pending;  ///< 中断记录、尚未应用的修改
+#endif
 #if !ZEROLIST_USE_MALLOC
     zerolist_node_t* node_buf;   ///< 节点缓冲区指针（静态模式）
     ZEROLIST_TYPE    max_nodes;  ///< 最大节点数量限制
@@ -208,9 +596,66 @@ typedef struct Zerolist
     ZEROLIST_TYPE  free_top;    ///< 空闲节点栈的栈顶索引
     ZEROLIST_TYPE* free_stack;  ///< 空闲节点索引栈，用于快速分配
 #endif
+#if ZEROLIST_DIRTY_TRACK
+    uint8_t* dirty_bits;  ///< 脏槽位位图，每个槽位 1 bit
+#if ZEROLIST_FAST_ALLOC
+    ZEROLIST_TYPE dirty_free_low;  ///< 上次检查点后空闲栈到达过的最低栈顶
+#endif
+#endif
 #endif
 } Zerolist;
 
+// ===========================================
+// 宏定义（扩展功能在静态定义中的附加字段）
+// ===========================================
+
+#if ZEROLIST_DIRTY_TRACK
+/// @brief 容纳 n 个槽位脏标记所需的字节数
+#define ZEROLIST_DIRTY_BYTES(n) (((size_t)(n) + 7u) >> 3)
+#define _ZEROLIST_DIRTY_DEFINE(name, _max_nodes) \
+    static uint8_t name##_dirty[ZEROLIST_DIRTY_BYTES(_max_nodes)];
+#define _ZEROLIST_DIRTY_FIELD(name) .dirty_bits = name##_dirty,
+#define _ZEROLIST_DIRTY_ARG(name)   .dirty_bits = (name).dirty_bits,
+#else
+#define _ZEROLIST_DIRTY_DEFINE(name, _max_nodes)
+#define _ZEROLIST_DIRTY_FIELD(name)
+#define _ZEROLIST_DIRTY_ARG(name)
+#endif
+
+#if ZEROLIST_BLOOM_ENABLE && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+#define _ZEROLIST_BLOOM_DEFINE(name, _max_nodes) \
+    static uint8_t name##_bloom[(size_t)(_max_nodes) * ZEROLIST_BLOOM_RATIO];
+#define _ZEROLIST_BLOOM_FIELD(name) \
+    .bloom = name##_bloom, .bloom_slots = sizeof(name##_bloom),
+#define _ZEROLIST_BLOOM_ARG(name) .bloom = (name).bloom, .bloom_slots = (name).bloom_slots,
+#else
+#define _ZEROLIST_BLOOM_DEFINE(name, _max_nodes)
+#define _ZEROLIST_BLOOM_FIELD(name)
+#define _ZEROLIST_BLOOM_ARG(name)
+#endif
+
+#if ZEROLIST_UNIQUE_ENABLE && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+#define _ZEROLIST_UNIQUE_DEFINE(name, _max_nodes) \
+    static zerolist_node_t* name##_index[(_max_nodes)];
+#define _ZEROLIST_UNIQUE_FIELD(name) \
+    .index = name##_index, .index_slots = sizeof(name##_index) / sizeof(name##_index[0]),
+#define _ZEROLIST_UNIQUE_ARG(name) .index = (name).index, .index_slots = (name).index_slots,
+#else
+#define _ZEROLIST_UNIQUE_DEFINE(name, _max_nodes)
+#define _ZEROLIST_UNIQUE_FIELD(name)
+#define _ZEROLIST_UNIQUE_ARG(name)
+#endif
+
+// ZEROLIST_INIT 把 ZEROLIST_DEFINE 定义的扩展存储交给 zerolist_init_expand_ex
+#if (ZEROLIST_DIRTY_TRACK || ZEROLIST_BLOOM_ENABLE || ZEROLIST_UNIQUE_ENABLE) \
+    && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+#define _ZEROLIST_EXT_STORAGE(name)                                                     \
+    (&(zerolist_ext_storage_t){ _ZEROLIST_DIRTY_ARG(name) _ZEROLIST_BLOOM_ARG(name) \
+                                    _ZEROLIST_UNIQUE_ARG(name) })
+#else
+#define _ZEROLIST_EXT_STORAGE(name) NULL
+#endif
+
 // ===========================================
 // 宏定义（声明与初始化）
 // ===========================================
@@ -254,13 +699,19 @@ typedef struct Zerolist
  *
  * @note 使用此宏后需要调用 ZEROLIST_INIT(name) 进行初始化
  */
-#define ZEROLIST_DEFINE(name, _max_nodes)                     \
-    static zerolist_node_t name##_buf[(_max_nodes)];          \
-    static ZEROLIST_TYPE   name##_free_stack[(_max_nodes)];   \
-    static Zerolist        name = { .head       = NULL,       \
-                                    .node_buf   = name##_buf, \
-                                    .max_nodes  = _max_nodes, \
-                                    .free_top   = _max_nodes, \
+#define ZEROLIST_DEFINE(name, _max_nodes)                      \
+    static zerolist_node_t name##_buf[(_max_nodes)];           \
+    static ZEROLIST_TYPE   name##_free_stack[(_max_nodes)];    \
+    _ZEROLIST_DIRTY_DEFINE(name, _max_nodes)                   \
+    _ZEROLIST_BLOOM_DEFINE(name, _max_nodes)                   \
+    _ZEROLIST_UNIQUE_DEFINE(name, _max_nodes)                  \
+    static Zerolist        name = { _ZEROLIST_DIRTY_FIELD(name)  \
+                                    _ZEROLIST_BLOOM_FIELD(name)  \
+                                    _ZEROLIST_UNIQUE_FIELD(name) \
+                                    .head       = NULL,        \
+                                    .node_buf   = name##_buf,  \
+                                    .max_nodes  = _max_nodes,  \
+                                    .free_top   = _max_nodes,  \
                                     .free_stack = name##_free_stack }
 #define ZEROLIST_DECLARE(name) extern Zerolist name;
 /**
@@ -269,8 +720,9 @@ typedef struct Zerolist
  *
  * 初始化由 ZEROLIST_DEFINE 定义的静态链表。
  */
-#define ZEROLIST_INIT(name) \
-    zerolist_init_expand(&(name), name.node_buf, name.free_stack, name.max_nodes)
+#define ZEROLIST_INIT(name)                                                 \
+    zerolist_init_expand_ex(&(name), name.node_buf, name.free_stack, name.max_nodes, \
+                            _ZEROLIST_EXT_STORAGE(name))
 
 #else  // ---------- 静态普通分配模式（无快速栈） ----------
 /**
@@ -285,15 +737,21 @@ typedef struct Zerolist
  *
  * @note 使用此宏后需要调用 ZEROLIST_INIT(name) 进行初始化
  */
-#define ZEROLIST_DEFINE(name, _max_nodes)            \
-    static zerolist_node_t name##_buf[(_max_nodes)]; \
-    static Zerolist name = { .head = NULL, .node_buf = name##_buf, .max_nodes = (_max_nodes) }
+#define ZEROLIST_DEFINE(name, _max_nodes)                            \
+    static zerolist_node_t name##_buf[(_max_nodes)];                 \
+    _ZEROLIST_DIRTY_DEFINE(name, _max_nodes)                         \
+    _ZEROLIST_BLOOM_DEFINE(name, _max_nodes)                         \
+    _ZEROLIST_UNIQUE_DEFINE(name, _max_nodes)                        \
+    static Zerolist name = { _ZEROLIST_DIRTY_FIELD(name) _ZEROLIST_BLOOM_FIELD(name)       \
+                             _ZEROLIST_UNIQUE_FIELD(name) .head = NULL,                    \
+                             .node_buf = name##_buf, .max_nodes = (_max_nodes) }
 #define ZEROLIST_DECLARE(name) extern Zerolist name;
 /**
  * @def ZEROLIST_INIT(name)
  * @brief 初始化静态链表（普通模式）
  */
-#define ZEROLIST_INIT(name)    zerolist_init_expand(&(name), name.node_buf, name.max_nodes)
+#define ZEROLIST_INIT(name) \
+    zerolist_init_expand_ex(&(name), name.node_buf, name.max_nodes, _ZEROLIST_EXT_STORAGE(name))
 #endif  // ZEROLIST_FAST_ALLOC
 
 #else  // ---------- 动态模式（malloc/free） ----------
@@ -319,6 +777,21 @@ typedef struct Zerolist
 // 遍历宏（统一接口 - 适用于所有模式）
 // ===========================================
 
+/**
+ * @def ZEROLIST_NODE_NEXT(list_ptr, node)
+ * @brief 按链表逻辑顺序取后继节点
+ *
+ * 未启用 ZEROLIST_LAZY_REVERSE 时等价于 node->next；
+ * 启用后根据链表方向标志在 next/prev 之间选择。
+ */
+#if ZEROLIST_LAZY_REVERSE
+#define ZEROLIST_NODE_NEXT(list_ptr, node) ((list_ptr)->reversed ? (node)->prev : (node)->next)
+#define ZEROLIST_NODE_PREV(list_ptr, node) ((list_ptr)->reversed ? (node)->next : (node)->prev)
+#else
+#define ZEROLIST_NODE_NEXT(list_ptr, node) ((node)->next)
+#define ZEROLIST_NODE_PREV(list_ptr, node) ((node)->prev)
+#endif
+
 /**
  * @def ZEROLIST_FOR_EACH(list_ptr, node_var)
  * @brief 链表遍历宏（不安全版本，统一接口）
@@ -343,7 +816,10 @@ typedef struct Zerolist
 #define ZEROLIST_FOR_EACH(list_ptr, node_var)                                           \
     if ((list_ptr)->head != NULL)                                                       \
         for (zerolist_node_t* node_var = (list_ptr)->head, *__first = (list_ptr)->head; \
-             node_var != NULL; node_var = (node_var->next == __first ? NULL : node_var->next))
+             node_var != NULL;                                                          \
+             node_var = (ZEROLIST_NODE_NEXT(list_ptr, node_var) == __first                \
+                             ? NULL                                                     \
+                             : ZEROLIST_NODE_NEXT(list_ptr, node_var)))
 
 /**
  * @def ZEROLIST_FOR_EACH_SAFE(list_ptr, node_var, tmp_var)
@@ -368,12 +844,14 @@ typedef struct Zerolist
  * }
  * @endcode
  */
-#define ZEROLIST_FOR_EACH_SAFE(list_ptr, node_var, tmp_var)                           \
-    if ((list_ptr)->head != NULL)                                                     \
-        for (zerolist_node_t* node_var = (list_ptr)->head, *tmp_var = node_var->next, \
-                              *__first  = (list_ptr)->head;                           \
-             node_var != NULL; node_var = (tmp_var == __first ? NULL : tmp_var),      \
-                              tmp_var   = (node_var ? node_var->next : NULL))
+#define ZEROLIST_FOR_EACH_SAFE(list_ptr, node_var, tmp_var)                                \
+    if ((list_ptr)->head != NULL)                                                          \
+        for (zerolist_node_t* node_var = (list_ptr)->head,                                 \
+                              *tmp_var = ZEROLIST_NODE_NEXT(list_ptr, node_var),           \
+                              *__first = (list_ptr)->head;                                 \
+             node_var != NULL; node_var = (tmp_var == __first ? NULL : tmp_var),           \
+                              tmp_var  = (node_var ? ZEROLIST_NODE_NEXT(list_ptr, node_var) \
+                                                   : NULL))
 
 // ===========================================
 // 函数声明
@@ -395,6 +873,19 @@ typedef struct Zerolist
  */
 bool list_init_dynamic(Zerolist* list);
 #else
+/**
+ * @struct zerolist_ext_storage
+ * @brief 静态模式下扩展功能使用的外部存储（未启用的功能对应字段被忽略）
+ */
+typedef struct zerolist_ext_storage
+{
+    uint8_t*          dirty_bits;   ///< 脏标记位图，ZEROLIST_DIRTY_BYTES(max_nodes) 字节
+    uint8_t*          bloom;        ///< 计数布隆过滤器计数器
+    size_t            bloom_slots;  ///< bloom 的计数器个数
+    zerolist_node_t** index;        ///< 成员索引桶数组
+    size_t            index_slots;  ///< index 的桶数
+} zerolist_ext_storage_t;
+
 /**
  * @brief 初始化静态链表（使用预分配缓冲区）
  *
@@ -411,6 +902,8 @@ bool list_init_dynamic(Zerolist* list);
  * @note 静态模式下，内存由用户管理，无需释放
  * @note 当 ZEROLIST_FAST_ALLOC=1 时，需要提供 free_stack 参数
  * @note 当 ZEROLIST_FAST_ALLOC=0 时，不需要 free_stack 参数
+ * @note 等同于 zerolist_init_expand_ex(..., NULL)：不读取 *list 的原有内容，
+ *       脏标记、布隆过滤器与成员索引处于关闭状态
  */
 void zerolist_init_expand(Zerolist* list, zerolist_node_t* buf,
 #if ZEROLIST_FAST_ALLOC
@@ -418,6 +911,22 @@ void zerolist_init_expand(Zerolist* list, zerolist_node_t* buf,
 #endif
                           ZEROLIST_TYPE max_nodes);
 
+/**
+ * @brief 初始化静态链表，并为扩展功能提供存储
+ *
+ * 参数同 zerolist_init_expand()，ext 给出脏标记 / 布隆过滤器 / 成员索引的存储。
+ * 链表结构体可以未初始化：扩展存储只从 ext 获取，ext 为 NULL 或其中某项为 NULL
+ * 时对应功能关闭。ZEROLIST_INIT 会传入 ZEROLIST_DEFINE 定义的存储。
+ *
+ * @param ext 扩展存储，可为 NULL
+ * @note 动态扩容模式下这些存储由 list_init_dynamic_expand() 分配，ext 被忽略
+ */
+void zerolist_init_expand_ex(Zerolist* list, zerolist_node_t* buf,
+#if ZEROLIST_FAST_ALLOC
+                             ZEROLIST_TYPE* free_stack,
+#endif
+                             ZEROLIST_TYPE max_nodes, const zerolist_ext_storage_t* ext);
+
 #if ZEROLIST_STATIC_DYNAMIC_EXPAND
 /**
  * @brief 初始化动态扩容链表（使用 malloc 分配初始缓冲区）
@@ -471,6 +980,22 @@ bool zerolist_push_front(Zerolist* list, void* data);
  */
 bool zerolist_push_back(Zerolist* list, void* data);
 
+/**
+ * @brief 固定窗口追加：节点池已满时把头节点原地改写为新的尾节点
+ *
+ * 适合“只保留最近 N 条”的遥测/限流窗口（N 即静态节点池容量）。池满时不经过
+ * 释放/分配，也不触碰空闲栈：旧头节点换上新数据后，头指针前进一步即成为尾节点。
+ * - 快速分配模式下“池满”判断为 O(1)；否则借助 zerolist_size 判断
+ * - 动态扩容 / malloc 回退模式在池满时同样淘汰而不是扩容或回退
+ * - 纯动态模式没有容量上限，等同于 zerolist_push_back
+ *
+ * @param list 链表指针
+ * @param data 要追加的数据指针
+ * @param evicted 输出被淘汰的数据指针（未淘汰时为 NULL），可为 NULL
+ * @return false 参数无效或分配失败且链表为空
+ */
+bool zerolist_push_back_evict(Zerolist* list, void* data, void** evicted);
+
 /**
  * @brief 在指定数据节点之前插入新节点（统一接口）
  *
@@ -487,6 +1012,78 @@ bool zerolist_push_back(Zerolist* list, void* data);
  */
 bool zerolist_insert_before(Zerolist* list, void* target_data, void* new_data);
 
+/**
+ * @brief 有序合并：把有序链表 src 并入有序链表 dst，O(n + m)
+ *
+ * 只沿两条链表各走一遍，不重新排序；相等元素中 dst 的排在前面（稳定）。
+ * - 纯动态模式：直接把 src 的节点重新链接进 dst，不做任何分配
+ * - 静态模式：节点属于各自的节点池，src 的数据改由 dst 的池分配节点承载（快速分配模式下 O(1)）
+ *
+ * @param dst 目标链表（升序）
+ * @param src 源链表（升序），成功后为空
+ * @param cmp 比较函数，a < b 返回负数，相等返回 0，a > b 返回正数
+ * @return false 参数无效，或 dst 节点池耗尽（此时两条链表仍各自有序，src 保留未并入的部分）
+ */
+bool zerolist_merge(Zerolist* dst, Zerolist* src, int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief k 路有序合并：用大小为 k 的小顶堆把 k 条有序链表依次追加到 out 尾部，O(n log k)
+ *
+ * 相等元素按链表在 lists 中的先后输出（稳定）；节点的移动方式同 zerolist_merge。
+ *
+ * @param out 输出链表（通常为空；非空时新元素追加在尾部）
+ * @param lists 有序链表数组，元素可为 NULL，不能包含 out，同一链表不能出现两次
+ * @param k 链表个数，不超过 ZEROLIST_MERGE_K_MAX
+ * @param cmp 比较函数，同 zerolist_merge
+ * @return false 参数无效，或 out 节点池耗尽（已输出的元素保持有序，其余仍在原链表中）
+ */
+bool zerolist_merge_k(Zerolist* out, Zerolist* const* lists, size_t k,
+                      int (*cmp)(const void* a, const void* b));
+
+/**
+ * @brief 去重：保留每组相等数据中最先出现的节点，一次遍历，期望 O(n)
+ *
+ * 临时哈希集合只分配桶数组（可 malloc 的模式按长度分配，否则使用栈上
+ * ZEROLIST_DEDUP_STACK_BUCKETS 个桶），冲突链借用已保留节点的链接指针，遍历结束后重建；
+ * 被删除的节点直接归还节点池。
+ *
+ * @param list 链表指针
+ * @param hash 数据哈希函数，相等的数据必须得到相同的哈希值
+ * @param eq 数据相等判断
+ * @return 删除的节点数
+ * @note hash 与 eq 同时为 NULL 时按指针去重
+ * @note 纯静态模式下桶数不随长度增长，链表远长于 ZEROLIST_DEDUP_STACK_BUCKETS 时
+ *       退化为约 O(n²/桶数)，需要时调大该宏
+ */
+size_t zerolist_unique(Zerolist* list, uint32_t (*hash)(const void* data),
+                       bool (*eq)(const void* a, const void* b));
+
+/**
+ * @brief 划分：把满足 pred 的数据按原顺序移到 out 尾部，其余留在 list 中且保持顺序
+ *
+ * 纯动态模式只重新链接节点；静态模式下节点属于各自的节点池，移动方式同 zerolist_merge。
+ *
+ * @param list 源链表
+ * @param pred 判定函数
+ * @param ctx 透传给 pred 的上下文
+ * @param out 输出链表（不能与 list 相同）
+ * @param moved 可为 NULL；输出已移到 out 的数据个数（失败时为停止前已移动的个数）
+ * @return true 全部满足 pred 的数据都已移到 out
+ * @return false 参数无效，或 out 节点池耗尽（已移动的数据在 out 中，其余仍在 list 中，两边顺序不变）
+ */
+bool zerolist_partition(Zerolist* list, bool (*pred)(const void* data, void* ctx), void* ctx,
+                        Zerolist* out, size_t* moved);
+
+/**
+ * @brief 原地稳定划分：满足 pred 的节点移到前部，两组内部都保持原顺序，O(n)
+ *
+ * 只修改链接，不分配也不释放节点。
+ *
+ * @return 满足 pred 的节点数（即前部长度）
+ */
+size_t zerolist_stable_partition(Zerolist* list, bool (*pred)(const void* data, void* ctx),
+                                 void* ctx);
+
 // ===========================================
 // 删除操作（统一接口 - 适用于所有模式）
 // ===========================================
@@ -578,6 +1175,56 @@ void* zerolist_pop_front(Zerolist* list);
  */
 bool zerolist_remove_at(Zerolist* list, ZEROLIST_TYPE index);
 
+/**
+ * @brief 按索引区间批量删除节点（统一接口）
+ *
+ * 删除索引位于 [first, last) 的节点：整段只做一次摘链，size 只更新一次，
+ * 静态模式下释放的槽位在同一次遍历中成批归还空闲栈，总代价 O(first + k)。
+ *
+ * @param list 指向链表的指针
+ * @param first 起始索引（包含）
+ * @param last 结束索引（不包含），超出链表长度时截断到末尾
+ * @return ZEROLIST_TYPE 实际删除的节点数
+ */
+ZEROLIST_TYPE zerolist_erase_range(Zerolist* list, ZEROLIST_TYPE first, ZEROLIST_TYPE last);
+
+/**
+ * @brief 按节点区间批量删除节点（统一接口）
+ *
+ * 删除从 first 到 last（均包含，按链表逻辑顺序）的连续节点，O(k)。
+ *
+ * @param list 指向链表的指针
+ * @param first 起始节点
+ * @param last 结束节点；为 NULL 或位于 first 之前时删除到链表末尾
+ * @return ZEROLIST_TYPE 实际删除的节点数
+ */
+ZEROLIST_TYPE zerolist_erase_nodes(Zerolist* list, zerolist_node_t* first, zerolist_node_t* last);
+
+/**
+ * @brief 按索引区间把节点移入另一个链表（统一接口）
+ *
+ * 把 [first, last) 的节点按原顺序追加到 out_list 尾部并从 list 中移除。
+ * - 动态模式：直接重新链接节点，不分配内存
+ * - 静态模式：节点池归各链表所有，数据指针复制到 out_list 的节点中，
+ *   out_list 容量不足时只移动能容纳的前缀
+ *
+ * @param list 源链表
+ * @param first 起始索引（包含）
+ * @param last 结束索引（不包含）
+ * @param out_list 目标链表（不能与 list 相同）
+ * @return ZEROLIST_TYPE 实际移动的节点数
+ */
+ZEROLIST_TYPE zerolist_extract_range(Zerolist* list, ZEROLIST_TYPE first, ZEROLIST_TYPE last,
+                                     Zerolist* out_list);
+
+/**
+ * @brief 按节点区间把节点移入另一个链表（统一接口）
+ *
+ * 语义同 zerolist_extract_range()，区间为 first 到 last（均包含）。
+ */
+ZEROLIST_TYPE zerolist_extract_nodes(Zerolist* list, zerolist_node_t* first, zerolist_node_t* last,
+                                     Zerolist* out_list);
+
 // ===========================================
 // 访问 / 查找（统一接口 - 适用于所有模式）
 // ===========================================
@@ -637,6 +1284,34 @@ zerolist_node_t* zerolist_search(Zerolist* list, const void* target_data,
  */
 void zerolist_foreach(Zerolist* list, void (*callback)(void* data));
 
+/**
+ * @brief 等概率随机选取一个节点（统一接口）
+ *
+ * - 纯静态 / 动态扩容模式：所有在用节点都位于 node_buf 中，随机探测槽位并检查
+ *   in_use，装载率为 α 时期望 1/α 次探测即可命中，O(1) 期望时间；
+ *   探测 ZEROLIST_RANDOM_PROBES 次仍未命中或装载率过低时退化为按随机下标遍历
+ * - 动态 / malloc 回退模式、或存在待回收节点时：按随机下标遍历
+ *
+ * @param list 链表指针
+ * @param rng 随机数发生器，返回均匀分布的 32 位随机数
+ * @param ctx 透传给 rng 的用户参数
+ * @return 选中的节点，链表为空时返回 NULL
+ */
+zerolist_node_t* zerolist_random(Zerolist* list, uint32_t (*rng)(void* ctx), void* ctx);
+
+/**
+ * @brief 无放回等概率抽取 k 个元素（蓄水池抽样，单次遍历）
+ *
+ * @param list 链表指针
+ * @param k 抽样个数
+ * @param out 输出数组（至少 k 个元素），保存被抽中节点的数据指针
+ * @param rng 随机数发生器
+ * @param ctx 透传给 rng 的用户参数
+ * @return 实际抽取的个数（链表长度不足 k 时为链表长度）
+ */
+ZEROLIST_TYPE zerolist_sample(Zerolist* list, ZEROLIST_TYPE k, void** out,
+                              uint32_t (*rng)(void* ctx), void* ctx);
+
 // ===========================================
 // 工具函数（统一接口 - 适用于所有模式）
 // ===========================================
@@ -650,9 +1325,57 @@ void zerolist_foreach(Zerolist* list, void (*callback)(void* data));
  * @param list 指向LinkedList结构体的指针
  *
  * @note 反转操作会修改链表的内部结构
+ * @note 启用 ZEROLIST_LAZY_REVERSE 时为 O(1)，只翻转方向标志
  */
 void zerolist_reverse(Zerolist* list);
 
+/**
+ * @brief 结构化克隆链表（统一接口）
+ *
+ * 将 src 的全部节点复制到 dst，dst 原有内容会被清空，两者之后互不影响。
+ * - 纯静态 / 动态扩容模式：整块 memcpy node_buf 与 free_stack，
+ *   再以一次线性遍历把 prev/next 重定位到 dst 的缓冲区，不逐个插入
+ * - 动态模式 / malloc 回退模式：单次遍历批量分配节点并直接串接
+ *
+ * @param dst 目标链表（需已按同一模式初始化）
+ * @param src 源链表
+ * @return true 克隆成功
+ * @return false 参数无效、dst 容量不足（纯静态模式要求 dst->max_nodes >= src->max_nodes）
+ *         或内存分配失败（此时 dst 为空）
+ */
+bool zerolist_clone(Zerolist* dst, const Zerolist* src);
+
+/**
+ * @brief 按逻辑顺序把节点数据指针批量导出到连续数组（统一接口）
+ *
+ * 展开遍历并预取后续节点，避免逐元素回调/分支，适合随后交给 SIMD 或
+ * 只接受数组的库处理。
+ *
+ * @param list 链表指针
+ * @param out 输出数组
+ * @param cap 输出数组容量
+ * @return 实际写入的元素个数（不超过 cap）
+ */
+ZEROLIST_TYPE zerolist_to_array(Zerolist* list, void** out, ZEROLIST_TYPE cap);
+
+/**
+ * @brief 用连续数组重建链表（统一接口）
+ *
+ * 链表原有内容会被清空，之后按数组顺序依次挂入 arr[0..count-1]。
+ * - 静态模式：节点按顺序铺设在 node_buf[0..count-1]，逻辑顺序与物理顺序一致，
+ *   空闲栈随之重建，后续分配从 count 号槽位继续
+ * - 动态扩容模式：容量不足时先一次性扩容到 count
+ * - malloc 回退模式：超出静态池的部分走回退分配
+ * - 动态模式：单次遍历批量分配并直接串接
+ *
+ * @param list 链表指针
+ * @param arr 数据指针数组
+ * @param count 元素个数
+ * @return true 成功
+ * @return false 参数无效、容量不足（纯静态模式下链表保持原样）或内存分配失败（此时链表为空）
+ */
+bool zerolist_from_array(Zerolist* list, void* const* arr, ZEROLIST_TYPE count);
+
 /**
  * @brief 清空链表（统一接口）
  *
@@ -682,6 +1405,36 @@ void zerolist_clear(Zerolist* list);
  */
 void zerolist_destroy(Zerolist* list);
 
+/**
+ * @brief 分步清空链表（统一接口，适用于实时循环）
+ *
+ * 第一次调用立即把整条链表摘下（O(1)），链表在逻辑上马上变为空并可继续插入；
+ * 被摘下的节点挂在 list->reclaim 上，之后每次调用最多回收 budget 个节点，
+ * 可把回收工作分摊到多个空闲周期。
+ *
+ * @param list 指向链表的指针
+ * @param budget 本次最多回收的节点数（0 表示只摘链不回收）
+ * @return true 仍有待回收节点，需要继续调用
+ * @return false 回收完毕
+ *
+ * @note 回收过程中再次调用会把新的链表内容一并并入待回收环
+ * @note zerolist_clear() 等价于以无限预算循环调用本函数
+ */
+bool zerolist_clear_step(Zerolist* list, ZEROLIST_TYPE budget);
+
+/**
+ * @brief 分步销毁链表（统一接口）
+ *
+ * - 动态扩容模式：节点都在库管理的缓冲区中，直接整体释放，O(1) 完成
+ * - 其他模式：按 zerolist_clear_step() 分步回收，完成后执行与 zerolist_destroy() 相同的收尾
+ *
+ * @param list 指向链表的指针
+ * @param budget 本次最多回收的节点数
+ * @return true 仍有工作未完成，需要继续调用
+ * @return false 销毁完毕
+ */
+bool zerolist_destroy_step(Zerolist* list, ZEROLIST_TYPE budget);
+
 /**
  * @brief 重新初始化链表（统一接口）
  *
@@ -697,7 +1450,8 @@ void zerolist_destroy(Zerolist* list);
  * @return false 初始化失败（参数无效或内存分配失败）
  *
  * @note 此函数必须在 zerolist_destroy() 之后调用
- * @note 对于纯静态模式，此函数会重新初始化状态，使用原有的缓冲区
+ * @note 对于纯静态模式，此函数会重新初始化状态，使用原有的缓冲区及扩展存储
+ *       （dirty_bits / bloom / index），因此 list 必须曾经成功初始化过
  * @note 对于动态扩容模式，必须提供有效的 initial_size 参数
  *
  * @example
@@ -740,6 +1494,1143 @@ ZEROLIST_TYPE zerolist_size(Zerolist* list);
  * @endcode
  */
 void zerolist_free_node(Zerolist* list, zerolist_node_t* node);
+
+#if ZEROLIST_SHM_ENABLE
+// ===========================================
+// 跨进程共享内存链表（ZEROLIST_SHM_ENABLE）
+// ===========================================
+
+/// @brief 共享内存中的空链接下标
+#define ZEROLIST_SHM_NIL ((ZEROLIST_TYPE)-1)
+
+/// @brief 共享内存区域布局（不透明，定义见 zerolist.c）
+typedef struct zerolist_shm_region zerolist_shm_region_t;
+
+/**
+ * @struct zerolist_shm
+ * @brief 进程本地的共享内存链表句柄
+ *
+ * 句柄只保存本进程的映射地址，区域内部不含任何绝对指针：
+ * 节点 prev/next 为 node 数组下标，负载槽位与节点一一对应，
+ * 因此同一区域可以被映射到不同进程的任意地址。
+ */
+typedef struct zerolist_shm
+{
+    zerolist_shm_region_t* region;    ///< 本进程中的映射基址
+    size_t                 map_size;  ///< 映射长度（字节）
+} zerolist_shm_t;
+
+/**
+ * @brief 创建并初始化一个命名共享内存链表
+ *
+ * @param shm 句柄
+ * @param name shm_open 名称（如 "/zl_queue"）
+ * @param max_nodes 节点（负载槽位）数量，必须小于 ZEROLIST_SHM_NIL
+ * @param elem_size 每个负载槽位的字节数
+ * @return true 创建成功
+ * @return false 参数无效、同名区域已存在或系统调用失败
+ */
+bool zerolist_shm_create(zerolist_shm_t* shm, const char* name, ZEROLIST_TYPE max_nodes,
+                         size_t elem_size);
+
+/**
+ * @brief 映射一个已由其他进程创建的共享内存链表
+ *
+ * @return false 区域不存在、大小不符或尚未完成初始化
+ */
+bool zerolist_shm_open(zerolist_shm_t* shm, const char* name);
+
+/**
+ * @brief 解除本进程映射（不删除区域）
+ */
+void zerolist_shm_close(zerolist_shm_t* shm);
+
+/**
+ * @brief 删除命名区域（已映射的进程仍可继续使用直到 close）
+ */
+bool zerolist_shm_unlink(const char* name);
+
+/**
+ * @brief 预留一个空闲负载槽位
+ *
+ * 生产者直接在返回的内存中写入负载，写完后调用 zerolist_shm_push_back() 发布，
+ * 全程无需拷贝。
+ *
+ * @return void* 本进程地址空间中的负载指针，池满返回 NULL
+ */
+void* zerolist_shm_alloc(zerolist_shm_t* shm);
+
+/**
+ * @brief 归还负载槽位（消费者处理完 zerolist_shm_pop_front() 的结果后调用）
+ */
+void zerolist_shm_free(zerolist_shm_t* shm, void* payload);
+
+/**
+ * @brief 将已预留的槽位链接到队尾
+ *
+ * @param payload 由 zerolist_shm_alloc() 返回的指针
+ * @return false 指针不属于该区域或槽位未被预留
+ */
+bool zerolist_shm_push_back(zerolist_shm_t* shm, void* payload);
+
+/**
+ * @brief 从队头取出一个槽位
+ *
+ * @return void* 本进程地址空间中的负载指针，队列为空返回 NULL
+ * @note 槽位仍处于预留状态，处理完后需调用 zerolist_shm_free()
+ */
+void* zerolist_shm_pop_front(zerolist_shm_t* shm);
+
+/**
+ * @brief 获取队列中已链接的节点数量
+ */
+ZEROLIST_TYPE zerolist_shm_size(zerolist_shm_t* shm);
+#endif  // ZEROLIST_SHM_ENABLE
+
+#if ZEROLIST_DIRTY_TRACK
+// ===========================================
+// 增量检查点（ZEROLIST_DIRTY_TRACK）
+// ===========================================
+
+/// @brief 检查点记录类型
+typedef enum
+{
+    ZEROLIST_DELTA_SLOT = 0,  ///< 槽位快照：index 为槽位下标
+    ZEROLIST_DELTA_FREE = 1,  ///< 空闲栈条目：index 为栈内位置，next 为该位置保存的槽位下标
+} zerolist_delta_kind_t;
+
+/**
+ * @struct zerolist_delta_rec
+ * @brief 检查点记录：脏槽位快照或变化过的空闲栈条目
+ *
+ * 链接以槽位下标表示，不含任何绝对节点地址，可直接写入持久化介质
+ * 或应用到另一块缓冲区上的副本。
+ */
+typedef struct zerolist_delta_rec
+{
+    uint8_t       kind;    ///< 记录类型（zerolist_delta_kind_t）
+    ZEROLIST_TYPE index;   ///< 槽位下标
+    ZEROLIST_TYPE prev;    ///< 前驱槽位下标（空闲槽位为自身）
+    ZEROLIST_TYPE next;    ///< 后继槽位下标（空闲槽位为自身）
+    uint8_t       in_use;  ///< 槽位是否在使用
+    void*         data;    ///< 节点数据指针
+#if ZEROLIST_BUFCHAIN_ENABLE
+    size_t len;  ///< 缓冲区长度
+    size_t off;  ///< 已消费偏移
+#endif
+} zerolist_delta_rec_t;
+
+/**
+ * @struct zerolist_delta_hdr
+ * @brief 检查点的链表级状态，每次检查点都会完整输出
+ */
+typedef struct zerolist_delta_hdr
+{
+    ZEROLIST_TYPE max_nodes;  ///< 检查点时的槽位数量
+    ZEROLIST_TYPE size;       ///< 节点数量
+    ZEROLIST_TYPE head;       ///< 头节点槽位下标（仅 has_head 为 1 时有效）
+    uint8_t       has_head;   ///< 链表是否非空
+#if ZEROLIST_LAZY_REVERSE
+    uint8_t reversed;  ///< 方向标志
+#endif
+#if ZEROLIST_FAST_ALLOC
+    ZEROLIST_TYPE free_top;  ///< 空闲栈栈顶
+    ZEROLIST_TYPE free_low;  ///< 变化过的空闲栈区间起点，[free_low, free_top) 随记录流输出
+#endif
+} zerolist_delta_hdr_t;
+
+/// @brief 检查点输出回调，每条记录（脏槽位或空闲栈条目）调用一次
+typedef void (*zerolist_delta_sink_t)(void* ctx, const zerolist_delta_rec_t* rec);
+
+/**
+ * @brief 输出上次检查点之后变化过的槽位，并清除脏标记
+ *
+ * 初始化（以及 clear/shrink 等整体操作）之后所有槽位都视为脏，
+ * 因此第一次检查点即为完整快照。FAST_ALLOC 模式下随后输出空闲栈中变化过的
+ * [free_low, free_top) 区间（ZEROLIST_DELTA_FREE 记录），检查点不引用主链表的任何内存。
+ *
+ * @param list 链表
+ * @param sink 脏槽位回调（可为 NULL，仅获取链表级状态并清除标记）
+ * @param ctx 透传给回调的用户指针
+ * @param hdr 输出链表级状态
+ * @return size_t 输出的记录数量
+ */
+size_t zerolist_checkpoint_delta(Zerolist* list, zerolist_delta_sink_t sink, void* ctx,
+                                 zerolist_delta_hdr_t* hdr);
+
+/**
+ * @brief 将一次检查点应用到副本
+ *
+ * 副本需使用与主链表相同的模式初始化；动态扩容模式下副本会按需扩容，
+ * 纯静态模式下副本的 max_nodes 必须不小于 hdr->max_nodes。
+ * 检查点必须按产生顺序依次应用。
+ *
+ * @param replica 副本链表
+ * @param hdr 检查点链表级状态
+ * @param recs 检查点输出的全部记录（槽位与空闲栈条目）
+ * @param count 记录数量
+ * @return false 参数无效或副本容量不足
+ */
+bool zerolist_apply_delta(Zerolist* replica, const zerolist_delta_hdr_t* hdr,
+                          const zerolist_delta_rec_t* recs, size_t count);
+#endif  // ZEROLIST_DIRTY_TRACK
+
+#if ZEROLIST_VIEW_ENABLE
+// ===========================================
+// 零拷贝子链表视图（ZEROLIST_VIEW_ENABLE）
+// ===========================================
+
+/**
+ * @struct zerolist_view
+ * @brief 链表中一段连续节点的只读视图
+ *
+ * 视图只记录起始节点与长度，不复制、不分配。创建时记下链表的修改计数，
+ * 链表发生任何结构修改（插入、删除、反转、扩容、重新初始化等）后视图即失效，
+ * 所有 zerolist_view_* 接口对失效视图返回空结果。
+ */
+typedef struct zerolist_view
+{
+    Zerolist*        list;       ///< 所属链表
+    zerolist_node_t* start;      ///< 起始节点
+    ZEROLIST_TYPE    count;      ///< 节点数量（遍历到链表末尾时提前结束）
+    uint32_t         mod_count;  ///< 创建时的链表修改计数
+} zerolist_view_t;
+
+/**
+ * @def ZEROLIST_VIEW_FOR_EACH(view_ptr, node_var)
+ * @brief 遍历视图中的节点（不检查有效性，调用前请先 zerolist_view_valid）
+ */
+#define ZEROLIST_VIEW_FOR_EACH(view_ptr, node_var)                                          \
+    for (ZEROLIST_TYPE __vi = 0, __vdone = 0; !__vdone; __vdone = 1)                          \
+        for (zerolist_node_t* node_var = (view_ptr)->count ? (view_ptr)->start : NULL;        \
+             node_var != NULL;                                                              \
+             node_var = (++__vi >= (view_ptr)->count                                        \
+                         || ZEROLIST_NODE_NEXT((view_ptr)->list, node_var)                  \
+                                == (view_ptr)->list->head)                                  \
+                            ? NULL                                                          \
+                            : ZEROLIST_NODE_NEXT((view_ptr)->list, node_var))
+
+/**
+ * @brief 以节点句柄创建视图，O(1)
+ *
+ * @param view 输出视图
+ * @param list 所属链表
+ * @param start 起始节点（如遍历中得到的节点或 zerolist_find 的结果）
+ * @param count 视图长度
+ */
+bool zerolist_view_from_node(zerolist_view_t* view, Zerolist* list, zerolist_node_t* start,
+                             ZEROLIST_TYPE count);
+
+/**
+ * @brief 以索引创建视图，O(index)
+ *
+ * @return false 索引越界
+ */
+bool zerolist_view_from_index(zerolist_view_t* view, Zerolist* list, ZEROLIST_TYPE index,
+                              ZEROLIST_TYPE count);
+
+/**
+ * @brief 检查视图创建后链表是否未被修改
+ */
+bool zerolist_view_valid(const zerolist_view_t* view);
+
+/**
+ * @brief 获取视图内第 index 个节点的数据
+ */
+void* zerolist_view_at(const zerolist_view_t* view, ZEROLIST_TYPE index);
+
+/**
+ * @brief 在视图内按地址查找节点
+ */
+zerolist_node_t* zerolist_view_find(const zerolist_view_t* view, const void* target_addr);
+
+/**
+ * @brief 在视图内使用比较函数查找节点
+ */
+zerolist_node_t* zerolist_view_search(const zerolist_view_t* view, const void* target_data,
+                                      bool (*cmp_func)(const void*, const void*));
+
+/**
+ * @brief 对视图内每个节点的数据执行回调
+ */
+void zerolist_view_foreach(const zerolist_view_t* view, void (*callback)(void* data));
+#endif  // ZEROLIST_VIEW_ENABLE
+
+#if ZEROLIST_AGGREGATE_ENABLE
+// ===========================================
+// 增量聚合（ZEROLIST_AGGREGATE_ENABLE）
+// ===========================================
+
+/**
+ * @brief 为链表设置幺半群，O(1)
+ *
+ * 设置时不遍历：非空链表的汇总值标记为失效，由第一次 zerolist_aggregate() 遍历一次计算。
+ *
+ * 之后的更新规则：
+ * - commutative 且提供 uncombine：任意位置插入与删除均为 O(1)
+ * - 其他幺半群（如最大值、不可交换的组合）按双栈维护：头部插入、尾部插入、头部删除均为
+ *   O(1)（头部删除均摊 O(1)，前段耗尽后下一次查询重建一次），因此队列式的尾进头出无需遍历；
+ *   中间插入在 commutative 时 O(1)，否则汇总值标记失效；尾部与中间删除标记失效
+ * - 移动节点、反转：commutative 时 O(1)，否则标记失效
+ * - 失效后由下一次 zerolist_aggregate() 遍历一次重新计算
+ *
+ * @param list 链表指针
+ * @param monoid 幺半群（需在链表生命周期内有效），NULL 表示关闭汇总
+ * @note 链表初始化（含 zerolist_reinit）会清除已设置的幺半群
+ */
+void zerolist_set_monoid(Zerolist* list, const zerolist_monoid_t* monoid);
+
+/**
+ * @brief 获取链表的汇总值
+ *
+ * @return 汇总值；未设置幺半群时返回 0，空链表返回 identity
+ */
+ZEROLIST_AGG_TYPE zerolist_aggregate(Zerolist* list);
+
+/**
+ * @brief 通知链表某些节点的数据被原地修改，汇总值需要重新计算
+ */
+void zerolist_aggregate_invalidate(Zerolist* list);
+#endif  // ZEROLIST_AGGREGATE_ENABLE
+
+#if ZEROLIST_BLOOM_ENABLE
+// ===========================================
+// 计数布隆过滤器（ZEROLIST_BLOOM_ENABLE）
+// ===========================================
+
+/**
+ * @brief 判断数据指针是否可能在链表中，O(ZEROLIST_BLOOM_HASHES)
+ *
+ * 过滤器大小随模式确定：
+ * - 纯静态 / malloc 回退：ZEROLIST_DEFINE 额外定义 max_nodes × ZEROLIST_BLOOM_RATIO 个计数器
+ * - 动态扩容：随 node_buf 一起分配，扩容时按新容量重建
+ * - 动态模式：初始按 16 个节点分配，元素数超出容量时翻倍重建（与 ZEROLIST_SIZE_ENABLE 无关）
+ *
+ * @return false 必定不在链表中
+ * @return true 可能在链表中（或过滤器不可用）
+ */
+bool zerolist_may_contain(Zerolist* list, const void* data);
+#endif  // ZEROLIST_BLOOM_ENABLE
+
+#if ZEROLIST_UNIQUE_ENABLE
+// ===========================================
+// 去重合并队列（ZEROLIST_UNIQUE_ENABLE）
+// ===========================================
+
+/**
+ * @brief 以集合语义入队：指针已在链表中时不再新增节点
+ *
+ * 适合事件/脏对象队列：生产者可重复投递同一对象，消费者每轮只处理一次。
+ * 成员索引的桶数随模式确定：
+ * - 纯静态 / malloc 回退：ZEROLIST_DEFINE 额外定义 max_nodes 个桶
+ * - 动态扩容：随 node_buf 一起分配，扩容时按新容量重建
+ * - 动态模式：初始 16 个桶，节点数超过桶数时翻倍重建（与 ZEROLIST_SIZE_ENABLE 无关）
+ *
+ * @param list 链表指针
+ * @param data 数据指针
+ * @param move_to_back 已在链表中时：true 移到队尾，false 保持原位置
+ * @return true 数据已在链表中（新入队或合并）
+ * @return false 参数无效或分配节点失败
+ * @note 索引不可用（如动态模式下分配失败）时退化为线性查找
+ */
+bool zerolist_push_back_unique(Zerolist* list, void* data, bool move_to_back);
+
+/**
+ * @brief 判断数据指针是否在链表中，期望 O(1)
+ */
+bool zerolist_contains(Zerolist* list, const void* data);
+#endif  // ZEROLIST_UNIQUE_ENABLE
+
+#if ZEROLIST_DEFER_ENABLE
+// ===========================================
+// 延迟修改日志（ZEROLIST_DEFER_ENABLE）
+// ===========================================
+
+/**
+ * @brief 记录一条延迟修改（可在中断中调用，可重入）
+ *
+ * O(1) 且不遍历链表、不分配节点，只占用日志中的一个槽位；多个中断优先级可同时记录。
+ *
+ * @param list 链表指针
+ * @param op 操作类型
+ * @param data 数据指针（不能为 NULL）
+ * @return false 参数无效或日志已满（ZEROLIST_DEFER_SLOTS 条未应用）
+ */
+bool zerolist_defer(Zerolist* list, zerolist_defer_op_t op, void* data);
+
+/**
+ * @brief 在任务上下文中按记录顺序应用所有已记录的修改
+ *
+ * 删除与移动的目标节点在同一次遍历中全部定位，之后逐条应用（每条 O(批量)），
+ * 结果与按记录顺序逐条立即执行完全相同：
+ * - 每条记录作用于执行到该条时“第一个数据为 data 的节点”，包括本批次前面
+ *   PUSH 产生的节点和被前面记录移动过的节点
+ * - 执行到该条时链表中已没有该数据则忽略该条
+ * - 动态扩容模式下 PUSH 触发的扩容不影响已定位的目标
+ *
+ * @note 只能由一个任务调用；与链表的其他修改操作之间仍需调用方互斥（中断记录除外）
+ * @return 本次从日志取出的记录数
+ */
+size_t zerolist_apply_pending(Zerolist* list);
+#endif  // ZEROLIST_DEFER_ENABLE
+
+#if ZEROLIST_SELF_ORGANIZE
+// ===========================================
+// 自组织查找（ZEROLIST_SELF_ORGANIZE）
+// ===========================================
+
+/**
+ * @brief 设置查找命中后的调整策略
+ *
+ * 命中节点的调整只修改前后链接，O(1)（计数策略需沿已经走过的前驱回溯）。
+ * 访问高度集中时，期望查找长度逐渐收敛到热点集合的大小。
+ *
+ * @param list 链表指针
+ * @param policy ZEROLIST_SEARCH_* 之一
+ * @note 调整会改变逻辑顺序，依赖插入顺序的场景请保持 ZEROLIST_SEARCH_NONE
+ */
+void zerolist_set_search_policy(Zerolist* list, uint8_t policy);
+
+/**
+ * @brief 读取查找统计
+ *
+ * @note 策略为 ZEROLIST_SEARCH_NONE 时 zerolist_find 不经过自组织路径，不计入统计
+ */
+zerolist_search_stats_t zerolist_get_search_stats(Zerolist* list);
+
+/**
+ * @brief 清零查找统计与所有节点的命中计数
+ */
+void zerolist_reset_search_stats(Zerolist* list);
+#endif  // ZEROLIST_SELF_ORGANIZE
+
+#if ZEROLIST_KEY_ENABLE
+// ===========================================
+// 节点内联键指纹（ZEROLIST_KEY_ENABLE）
+// ===========================================
+
+/**
+ * @brief 设置键提取函数，并为已有节点重新计算键
+ *
+ * 此后每个进入链表的节点都会调用 key_func(data) 把键写入节点；
+ * 键应由数据决定且在数据位于链表期间保持不变（如对象的 32 位 ID）。
+ *
+ * @param list 链表指针
+ * @param key_func 键提取函数，NULL 表示停用（zerolist_search_key 退化为 zerolist_search /
+ *                 zerolist_find）
+ */
+void zerolist_set_key_func(Zerolist* list, ZEROLIST_KEY_TYPE (*key_func)(const void* data));
+
+/**
+ * @brief 按键指纹查找节点
+ *
+ * 遍历时只读取节点本身，键不相等的节点不解引用 data；
+ * 键相等时再调用 cmp_func 确认，以处理指纹冲突。
+ *
+ * @param list 链表指针
+ * @param key 目标的键（与键提取函数对目标数据的结果一致）
+ * @param target_data 传给 cmp_func 的目标数据
+ * @param cmp_func 比较函数；NULL 表示键相等即命中（键唯一标识数据时使用）
+ * @return zerolist_node_t* 找到的节点，未找到返回 NULL
+ * @note 未设置键提取函数时等同于 zerolist_search(list, target_data, cmp_func)；
+ *       此时 cmp_func 为 NULL 则等同于 zerolist_find(list, target_data)（按数据指针相等）
+ * @note 启用 ZEROLIST_SELF_ORGANIZE 时同样统计探测深度并按策略调整命中节点
+ */
+zerolist_node_t* zerolist_search_key(Zerolist* list, ZEROLIST_KEY_TYPE key,
+                                     const void* target_data,
+                                     bool (*cmp_func)(const void*, const void*));
+#endif  // ZEROLIST_KEY_ENABLE
+
+#if ZEROLIST_BUFCHAIN_ENABLE
+// ===========================================
+// 分散/聚集缓冲区链（ZEROLIST_BUFCHAIN_ENABLE）
+// ===========================================
+
+/**
+ * @brief 在链表尾部追加一个缓冲区（统一接口）
+ *
+ * 节点的 data 指向缓冲区首地址，len 记录其长度，off 置 0。
+ * 普通的 zerolist_push_back() 等插入接口得到 len = 0 的节点。
+ *
+ * @param list 链表指针
+ * @param buf 缓冲区首地址（由调用者持有，链表不复制）
+ * @param len 缓冲区长度（字节）
+ * @return true 成功
+ * @return false 参数无效或节点分配失败
+ */
+bool zerolist_push_back_buf(Zerolist* list, void* buf, size_t len);
+
+/**
+ * @brief 把链表中待发送的数据导出为 iovec 数组，供 writev/sendmsg 零拷贝发送
+ *
+ * 从头节点开始，每个节点输出 { data + off, len - off }，跳过没有剩余数据的节点。
+ *
+ * @param list 链表指针
+ * @param iov 输出数组
+ * @param max 输出数组容量
+ * @return 写入的 iovec 个数
+ */
+int zerolist_to_iovec(Zerolist* list, struct iovec* iov, int max);
+
+/**
+ * @brief 按字节数消费链表头部的数据（如 writev 返回的已发送字节数）
+ *
+ * 完全发送的缓冲区从链表中移除并回调 release（可为 NULL），
+ * 部分发送的缓冲区只推进 off，保留在链表头部等待下次发送。
+ *
+ * @param list 链表指针
+ * @param nbytes 已消费的字节数
+ * @param release 缓冲区释放回调，参数为缓冲区首地址与 ctx
+ * @param ctx 透传给 release 的用户参数
+ * @return 实际消费的字节数（链表数据不足时小于 nbytes）
+ * @note nbytes 为 0 时直接返回，不移除头部的空缓冲区
+ */
+size_t zerolist_consume(Zerolist* list, size_t nbytes, void (*release)(void* buf, void* ctx),
+                        void* ctx);
+
+/**
+ * @brief 统计链表中待发送的总字节数，O(n)
+ */
+size_t zerolist_pending_bytes(Zerolist* list);
+#endif  // ZEROLIST_BUFCHAIN_ENABLE
+
+#if ZEROLIST_ORDER_ENABLE
+// ===========================================
+// 顺序维护标签（ZEROLIST_ORDER_ENABLE）
+// ===========================================
+
+/**
+ * @brief 判断节点 a 是否在节点 b 之前（按链表逻辑顺序），O(1)
+ *
+ * 标签沿 next 方向在 32 位空间内循环递增，比较时以表头标签为原点，
+ * 因此表头变化（如移到队尾的旋转）不需要重标号。插入取相邻标签的中点，
+ * 间隙用尽时按 Dietz–Sleator 方式只对附近一段节点重新均匀分配标签。
+ *
+ * @param list 链表指针
+ * @param a 链表中的节点
+ * @param b 链表中的节点
+ * @return true a 严格位于 b 之前
+ * @return false a 在 b 之后、a == b 或参数无效
+ * @note 节点必须属于 list，否则结果无意义
+ */
+bool zerolist_precedes(Zerolist* list, const zerolist_node_t* a, const zerolist_node_t* b);
+
+/**
+ * @brief 比较两个节点的位置，O(1)
+ *
+ * @return 小于 0 表示 a 在 b 之前，0 表示同一节点，大于 0 表示 a 在 b 之后
+ */
+int zerolist_order_compare(Zerolist* list, const zerolist_node_t* a, const zerolist_node_t* b);
+#endif  // ZEROLIST_ORDER_ENABLE
+
+#if ZEROLIST_MULTI_ENABLE
+// ===========================================
+// 多链表成员节点（ZEROLIST_MULTI_ENABLE）
+// ===========================================
+
+struct zerolist_mnode;
+struct zerolist_mlist;
+
+/**
+ * @struct zerolist_mlink
+ * @brief 节点在某一条链表中的前后链接
+ */
+typedef struct zerolist_mlink
+{
+    struct zerolist_mnode* prev;  ///< 前驱节点
+    struct zerolist_mnode* next;  ///< 后继节点（空闲节点用作空闲链）
+} zerolist_mlink_t;
+
+/**
+ * @struct zerolist_mnode
+ * @brief 多链表节点：一个负载、K 组链接，link[i] 属于池中槽位 i 上的链表
+ */
+typedef struct zerolist_mnode
+{
+    void*            data;                        ///< 节点数据指针
+    zerolist_mlink_t link[ZEROLIST_MULTI_LINKS];  ///< 各链表中的链接
+    uint32_t         member;                      ///< 所在链表的槽位位图
+    uint8_t          in_use;                      ///< 节点已从池中分配
+    uint8_t          heap;                        ///< 节点由 malloc 回退分配
+} zerolist_mnode_t;
+
+/**
+ * @struct zerolist_mpool
+ * @brief 多链表共享的节点池，最多绑定 ZEROLIST_MULTI_LINKS 条链表
+ *
+ * 节点来自静态缓冲区，空闲节点通过 link[0].next 串成空闲链，分配/归还均为 O(1)。
+ * 缓冲区耗尽时，若开启 ZEROLIST_USE_MALLOC 或 ZEROLIST_STATIC_FALLBACK_MALLOC，
+ * 改用 ZEROLIST_MALLOC 分配单个节点。
+ */
+typedef struct zerolist_mpool
+{
+    zerolist_mnode_t*      node_buf;                      ///< 节点缓冲区
+    ZEROLIST_TYPE          max_nodes;                     ///< 缓冲区节点数
+    ZEROLIST_TYPE          used;                          ///< 已分配的节点数（含回退节点）
+    zerolist_mnode_t*      free_list;                     ///< 空闲链表头
+    struct zerolist_mlist* lists[ZEROLIST_MULTI_LINKS];  ///< 各槽位绑定的链表
+} zerolist_mpool_t;
+
+/**
+ * @struct zerolist_mlist
+ * @brief 绑定在节点池某个槽位上的双向循环链表
+ */
+typedef struct zerolist_mlist
+{
+    zerolist_mpool_t* pool;  ///< 所属节点池
+    zerolist_mnode_t* head;  ///< 链表头节点
+    ZEROLIST_TYPE     size;  ///< 当前节点数量
+    uint8_t           slot;  ///< 使用节点中的 link[slot]
+} zerolist_mlist_t;
+
+/**
+ * @def ZEROLIST_MPOOL_DEFINE(name, _max_nodes)
+ * @brief 定义静态多链表节点池，使用前需调用 ZEROLIST_MPOOL_INIT(name)
+ */
+#define ZEROLIST_MPOOL_DEFINE(name, _max_nodes)      \
+    static zerolist_mnode_t name##_buf[(_max_nodes)]; \
+    static zerolist_mpool_t name = { .node_buf = name##_buf, .max_nodes = (_max_nodes) }
+#define ZEROLIST_MPOOL_INIT(name) zerolist_mpool_init(&(name), (name).node_buf, (name).max_nodes)
+
+/**
+ * @def ZEROLIST_MLIST_FOR_EACH(list_ptr, node_var)
+ * @brief 遍历多链表（循环体内不可释放或摘除 node_var）
+ */
+#define ZEROLIST_MLIST_FOR_EACH(list_ptr, node_var)                                     \
+    for (zerolist_mnode_t* node_var = (list_ptr)->head; node_var != NULL;               \
+         node_var = node_var->link[(list_ptr)->slot].next == (list_ptr)->head           \
+                        ? NULL                                                          \
+                        : node_var->link[(list_ptr)->slot].next)
+
+/**
+ * @brief 初始化节点池
+ *
+ * @param pool 节点池
+ * @param buf 节点缓冲区（可为 NULL，此时只能使用 malloc 回退节点）
+ * @param max_nodes 缓冲区节点数
+ */
+void zerolist_mpool_init(zerolist_mpool_t* pool, zerolist_mnode_t* buf, ZEROLIST_TYPE max_nodes);
+
+/**
+ * @brief 释放节点池中所有节点（先从各链表摘除），池回到初始状态
+ *
+ * @note 不在任何链表中的 malloc 回退节点无法被找到，需在此之前调用 zerolist_mnode_release()
+ */
+void zerolist_mpool_clear(zerolist_mpool_t* pool);
+
+/**
+ * @brief 在节点池的 slot 槽位上初始化一条链表
+ *
+ * @return false 参数无效或槽位已被其他链表占用
+ */
+bool zerolist_mlist_init(zerolist_mlist_t* list, zerolist_mpool_t* pool, uint8_t slot);
+
+/**
+ * @brief 从节点池分配一个节点，O(1)
+ *
+ * @return 新节点（不在任何链表中），池耗尽返回 NULL
+ */
+zerolist_mnode_t* zerolist_mnode_alloc(zerolist_mpool_t* pool, void* data);
+
+/**
+ * @brief 从所有链表摘除节点并归还节点池，O(ZEROLIST_MULTI_LINKS)
+ *
+ * @note 其他节点池缓冲区中的节点被忽略
+ */
+void zerolist_mnode_release(zerolist_mpool_t* pool, zerolist_mnode_t* node);
+
+/**
+ * @brief 判断节点是否在链表中，O(1)
+ *
+ * @return false 节点不在该链表中，或节点不属于该链表的节点池
+ * @note 缓冲区节点按地址校验归属；malloc 回退节点无法按地址校验，由调用方保证来自同一节点池
+ */
+bool zerolist_mnode_in(const zerolist_mlist_t* list, const zerolist_mnode_t* node);
+
+/**
+ * @brief 把节点链接到链表头部 / 尾部，O(1)
+ *
+ * @return false 参数无效、节点不属于该链表的节点池、未分配或已在该链表中
+ */
+bool zerolist_mlist_push_front(zerolist_mlist_t* list, zerolist_mnode_t* node);
+bool zerolist_mlist_push_back(zerolist_mlist_t* list, zerolist_mnode_t* node);
+
+/**
+ * @brief 把节点从链表中摘除（节点仍保留在其他链表中，不归还节点池），O(1)
+ *
+ * @return false 节点不在该链表中（含不属于该链表的节点池）
+ */
+bool zerolist_mlist_remove(zerolist_mlist_t* list, zerolist_mnode_t* node);
+
+/**
+ * @brief 把链表中的节点移到尾部（如 LRU 访问），O(1)
+ */
+bool zerolist_mlist_move_to_back(zerolist_mlist_t* list, zerolist_mnode_t* node);
+
+/**
+ * @brief 摘除并返回头部节点（不归还节点池），空链表返回 NULL
+ */
+zerolist_mnode_t* zerolist_mlist_pop_front(zerolist_mlist_t* list);
+#endif  // ZEROLIST_MULTI_ENABLE
+
+#if ZEROLIST_PERSISTENT_ENABLE
+// ===========================================
+// 持久化链表版本（ZEROLIST_PERSISTENT_ENABLE）
+// ===========================================
+
+/**
+ * @struct zerolist_pnode
+ * @brief 持久化链表节点，创建后 data/next 不再改变
+ *
+ * 一个版本就是指向其首节点的指针（NULL 表示空版本）。新版本通过头插共享旧版本的全部节点，
+ * 每个节点的 refs 统计指向它的版本句柄与前驱节点数。
+ */
+typedef struct zerolist_pnode
+{
+    void*                  data;       ///< 节点数据指针
+    struct zerolist_pnode* next;       ///< 后继节点（版本的尾部）
+    uint32_t               refs;       ///< 引用计数（原子操作）
+    uint32_t               free_next;  ///< 空闲链中下一个节点的下标 + 1（0 表示结尾）
+} zerolist_pnode_t;
+
+/**
+ * @struct zerolist_ppool
+ * @brief 持久化节点的静态池
+ *
+ * 空闲链头为 {版本号:32, 下标+1:32}，以 64 位 CAS 无锁分配与归还，版本号避免 ABA。
+ * 节点内存在池的生命周期内始终有效，zerolist_pcell_acquire() 依赖这一点实现无锁读取。
+ */
+typedef struct zerolist_ppool
+{
+    zerolist_pnode_t* node_buf;   ///< 节点缓冲区
+    ZEROLIST_TYPE     max_nodes;  ///< 缓冲区节点数
+    uint64_t          free_head;  ///< 空闲链头（原子操作）
+} zerolist_ppool_t;
+
+/**
+ * @struct zerolist_pcell
+ * @brief 发布当前版本的共享单元：写者 publish，读者 acquire，均不加锁
+ */
+typedef struct zerolist_pcell
+{
+    zerolist_pnode_t* ver;  ///< 当前版本（单元自身持有一个引用）
+} zerolist_pcell_t;
+
+/**
+ * @def ZEROLIST_PPOOL_DEFINE(name, _max_nodes)
+ * @brief 定义静态持久化节点池，使用前需调用 ZEROLIST_PPOOL_INIT(name)
+ */
+#define ZEROLIST_PPOOL_DEFINE(name, _max_nodes)      \
+    static zerolist_pnode_t name##_buf[(_max_nodes)]; \
+    static zerolist_ppool_t name = { .node_buf = name##_buf, .max_nodes = (_max_nodes) }
+#define ZEROLIST_PPOOL_INIT(name) zerolist_ppool_init(&(name), (name).node_buf, (name).max_nodes)
+
+/**
+ * @def ZEROLIST_PVER_FOR_EACH(ver, node_var)
+ * @brief 遍历版本中的节点（调用方需持有该版本的引用）
+ */
+#define ZEROLIST_PVER_FOR_EACH(ver, node_var) \
+    for (const zerolist_pnode_t* node_var = (ver); node_var != NULL; node_var = node_var->next)
+
+/**
+ * @brief 初始化持久化节点池（不可与其他线程的操作并发）
+ */
+void zerolist_ppool_init(zerolist_ppool_t* pool, zerolist_pnode_t* buf, ZEROLIST_TYPE max_nodes);
+
+/**
+ * @brief 在 ver 之前头插 data，生成新版本，O(1)
+ *
+ * 新版本与 ver 共享全部节点；调用方对 ver 的引用不受影响。
+ *
+ * @param pool 节点池
+ * @param ver 旧版本（NULL 表示空版本）
+ * @param data 数据指针
+ * @return 新版本（调用方持有一个引用），池耗尽返回 NULL
+ */
+zerolist_pnode_t* zerolist_pver_push_front(zerolist_ppool_t* pool, zerolist_pnode_t* ver,
+                                           void* data);
+
+/**
+ * @brief 取得去掉首元素后的版本（即 ver->next），O(1)
+ *
+ * @param data 输出首元素数据（可为 NULL）
+ * @return 尾部版本（调用方持有一个新引用），ver 为空时返回 NULL
+ */
+zerolist_pnode_t* zerolist_pver_pop_front(zerolist_pnode_t* ver, void** data);
+
+/**
+ * @brief 增加版本引用，返回 ver 本身
+ */
+zerolist_pnode_t* zerolist_pver_retain(zerolist_pnode_t* ver);
+
+/**
+ * @brief 释放版本引用；计数归零的节点归还节点池并继续释放其尾部
+ */
+void zerolist_pver_release(zerolist_ppool_t* pool, zerolist_pnode_t* ver);
+
+/**
+ * @brief 获取版本长度，O(n)
+ */
+ZEROLIST_TYPE zerolist_pver_length(const zerolist_pnode_t* ver);
+
+/**
+ * @brief 发布新版本：单元持有 ver 的一个引用，并释放之前发布的版本
+ */
+void zerolist_pcell_publish(zerolist_ppool_t* pool, zerolist_pcell_t* cell, zerolist_pnode_t* ver);
+
+/**
+ * @brief 读取当前发布的版本，无锁
+ *
+ * @return 当前版本（调用方持有一个引用，用完后 zerolist_pver_release），未发布时返回 NULL
+ */
+zerolist_pnode_t* zerolist_pcell_acquire(zerolist_ppool_t* pool, zerolist_pcell_t* cell);
+#endif  // ZEROLIST_PERSISTENT_ENABLE
+
+#if ZEROLIST_SHARD_ENABLE
+// ===========================================
+// 分片链表（ZEROLIST_SHARD_ENABLE）
+// ===========================================
+
+/**
+ * @struct zerolist_shard
+ * @brief 单个分片：独立的链表与节点池，按缓存行对齐，避免分片之间伪共享
+ */
+typedef struct zerolist_shard
+{
+    Zerolist list;  ///< 分片链表
+    uint8_t  lock;  ///< 自旋锁（只在与汇总操作并发时才会竞争）
+} __attribute__((aligned(ZEROLIST_CACHE_LINE))) zerolist_shard_t;
+
+/**
+ * @struct zerolist_sharded
+ * @brief 分片链表：不保证全局顺序，只保证同一分片内的追加顺序
+ */
+typedef struct zerolist_sharded
+{
+    zerolist_shard_t* shards;           ///< 分片数组
+    uint32_t          count;            ///< 分片数
+    ZEROLIST_TYPE     nodes_per_shard;  ///< 每个分片的节点数（动态模式为初始值，不作限制）
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+    zerolist_node_t* bufs;  ///< 所有分片的节点缓冲区（count × nodes_per_shard）
+#if ZEROLIST_FAST_ALLOC
+    ZEROLIST_TYPE* stacks;  ///< 所有分片的空闲栈
+#endif
+#endif
+} zerolist_sharded_t;
+
+#if !ZEROLIST_USE_MALLOC && !ZEROLIST_STATIC_DYNAMIC_EXPAND
+#if ZEROLIST_FAST_ALLOC
+#define _ZEROLIST_SHARD_POOL_DEFINE(name, _n) \
+    static zerolist_node_t name##_bufs[(_n)];   \
+    static ZEROLIST_TYPE   name##_stacks[(_n)];
+#define _ZEROLIST_SHARD_POOL_FIELD(name) .bufs = name##_bufs, .stacks = name##_stacks,
+#else
+#define _ZEROLIST_SHARD_POOL_DEFINE(name, _n) static zerolist_node_t name##_bufs[(_n)];
+#define _ZEROLIST_SHARD_POOL_FIELD(name)      .bufs = name##_bufs,
+#endif
+#else
+#define _ZEROLIST_SHARD_POOL_DEFINE(name, _n)
+#define _ZEROLIST_SHARD_POOL_FIELD(name)
+#endif
+
+/**
+ * @def ZEROLIST_SHARDED_DEFINE(name, _shards, _nodes)
+ * @brief 定义分片链表：_shards 个分片，每个分片 _nodes 个节点
+ *
+ * 静态模式下一并定义所有分片的节点缓冲区与空闲栈；使用前需调用 ZEROLIST_SHARDED_INIT(name)
+ */
+#define ZEROLIST_SHARDED_DEFINE(name, _shards, _nodes)                      \
+    _ZEROLIST_SHARD_POOL_DEFINE(name, (size_t)(_shards) * (_nodes))         \
+    static zerolist_shard_t   name##_shards[(_shards)];                     \
+    static zerolist_sharded_t name = { _ZEROLIST_SHARD_POOL_FIELD(name)     \
+                                       .shards          = name##_shards,   \
+                                       .count           = (_shards),       \
+                                       .nodes_per_shard = (_nodes) }
+#define ZEROLIST_SHARDED_INIT(name) zerolist_sharded_init(&(name))
+
+/**
+ * @brief 初始化全部分片（shards/count/nodes_per_shard 及静态缓冲区需已设置）
+ *
+ * @return false 参数无效或某个分片分配失败（已初始化的分片会被销毁）
+ */
+bool zerolist_sharded_init(zerolist_sharded_t* sharded);
+
+/**
+ * @brief 销毁全部分片
+ */
+void zerolist_sharded_destroy(zerolist_sharded_t* sharded);
+
+/**
+ * @brief 当前线程的本地分片下标
+ *
+ * 每个线程首次调用时按轮转分配一个编号，之后固定不变；编号对分片数取模。
+ */
+uint32_t zerolist_sharded_local(const zerolist_sharded_t* sharded);
+
+/**
+ * @brief 追加到指定分片尾部
+ *
+ * @param shard 分片下标（通常为 zerolist_sharded_local() 或 CPU 编号），超出范围时取模
+ * @return false 参数无效或该分片节点池已满
+ */
+bool zerolist_sharded_push_back(zerolist_sharded_t* sharded, uint32_t shard, void* data);
+
+/**
+ * @brief 所有分片的节点总数（逐个分片读取，并发追加时为近似值）
+ */
+size_t zerolist_sharded_size(zerolist_sharded_t* sharded);
+
+/**
+ * @brief 按分片顺序遍历所有数据（同一分片内保持追加顺序）
+ *
+ * @note 回调期间持有该分片的锁，回调内不可操作同一分片链表
+ */
+void zerolist_sharded_foreach(zerolist_sharded_t* sharded, void (*callback)(void* data));
+
+/**
+ * @brief 取出所有分片中的数据并逐个交给 fn 处理
+ *
+ * 每次在锁内最多摘取一小批节点，回调在锁外执行，生产者只会被短暂阻塞。
+ *
+ * @return 处理的数据个数
+ */
+size_t zerolist_sharded_drain(zerolist_sharded_t* sharded, void (*fn)(void* data, void* ctx),
+                              void* ctx);
+#endif  // ZEROLIST_SHARD_ENABLE
+
+#if ZEROLIST_WSDEQUE_ENABLE
+// ===========================================
+// 工作窃取双端队列（ZEROLIST_WSDEQUE_ENABLE）
+// ===========================================
+
+/**
+ * @struct zerolist_wsbuf
+ * @brief 双端队列的环形缓冲区，容量为 2 的幂
+ */
+typedef struct zerolist_wsbuf
+{
+    void**                 slot;     ///< 槽位数组
+    size_t                 mask;     ///< 容量 - 1
+    struct zerolist_wsbuf* retired;  ///< 扩容前的旧缓冲（窃取者可能仍在读取，销毁时统一释放）
+} zerolist_wsbuf_t;
+
+/**
+ * @struct zerolist_wsdeque
+ * @brief Chase–Lev 工作窃取双端队列
+ *
+ * 只有所有者线程可以 push/pop（底端），任意线程可以 steal（顶端）。
+ * top 与 bottom 位于不同缓存行，窃取者的 CAS 不会干扰所有者的快路径。
+ */
+typedef struct zerolist_wsdeque
+{
+    int64_t top __attribute__((aligned(ZEROLIST_CACHE_LINE)));     ///< 顶端（窃取端）
+    int64_t bottom __attribute__((aligned(ZEROLIST_CACHE_LINE)));  ///< 底端（所有者端）
+    zerolist_wsbuf_t* buf;        ///< 当前缓冲
+    zerolist_wsbuf_t  initial;    ///< 初始缓冲（槽位由调用方或 init 提供）
+    uint8_t           own_slots;  ///< 初始槽位是否由 init 分配
+} zerolist_wsdeque_t;
+
+/**
+ * @def ZEROLIST_WSDEQUE_DEFINE(name, _capacity)
+ * @brief 定义带静态槽位的双端队列，_capacity 必须是 2 的幂
+ *
+ * 使用前需调用 ZEROLIST_WSDEQUE_INIT(name)。
+ */
+#define ZEROLIST_WSDEQUE_DEFINE(name, _capacity)           \
+    static void*              name##_slots[(_capacity)]; \
+    static zerolist_wsdeque_t name
+#define ZEROLIST_WSDEQUE_INIT(name)              \
+    zerolist_wsdeque_init(&(name), name##_slots, \
+                          sizeof(name##_slots) / sizeof(name##_slots[0]))
+
+/**
+ * @brief 初始化双端队列
+ *
+ * @param slots 初始槽位数组；为 NULL 时在可 malloc 的模式下用 ZEROLIST_MALLOC 分配
+ * @param capacity 初始容量，必须是 2 的幂且不小于 2
+ * @return false 参数无效或分配失败
+ */
+bool zerolist_wsdeque_init(zerolist_wsdeque_t* deque, void** slots, size_t capacity);
+
+/**
+ * @brief 销毁双端队列，释放扩容产生的缓冲区
+ *
+ * @note 调用时不能再有窃取者访问该队列
+ */
+void zerolist_wsdeque_destroy(zerolist_wsdeque_t* deque);
+
+/**
+ * @brief 所有者在底端压入任务
+ *
+ * 快路径只有普通读写与一次 release 存储，没有原子读改写。
+ *
+ * @param task 任务指针（不能为 NULL）
+ * @return false 参数无效，或缓冲区已满且无法扩容（纯静态模式 / 分配失败）
+ */
+bool zerolist_wsdeque_push(zerolist_wsdeque_t* deque, void* task);
+
+/**
+ * @brief 所有者从底端弹出最近压入的任务（LIFO）
+ *
+ * 只有队列剩最后一个任务、需要与窃取者竞争时才会执行 CAS。
+ *
+ * @return 任务指针，队列为空时返回 NULL
+ */
+void* zerolist_wsdeque_pop(zerolist_wsdeque_t* deque);
+
+/**
+ * @brief 任意线程从顶端窃取最早压入的任务（FIFO）
+ *
+ * @return 任务指针；队列为空或与其他线程竞争失败时返回 NULL（调用方可换一个队列重试）
+ */
+void* zerolist_wsdeque_steal(zerolist_wsdeque_t* deque);
+
+/**
+ * @brief 当前任务数（并发访问时为近似值）
+ */
+size_t zerolist_wsdeque_size(const zerolist_wsdeque_t* deque);
+#endif  // ZEROLIST_WSDEQUE_ENABLE
+
+#if ZEROLIST_CHAN_ENABLE
+// ===========================================
+// 对象回收通道（ZEROLIST_CHAN_ENABLE）
+// ===========================================
+
+/**
+ * @struct zerolist_cnode
+ * @brief 通道节点：携带一块缓冲区，在空闲链、就绪队列与持有者之间流转
+ */
+typedef struct zerolist_cnode
+{
+    struct zerolist_cnode* next;  ///< 所在队列中的下一个节点
+    void*                  data;  ///< 缓冲区指针
+    size_t                 len;   ///< 有效字节数（由生产者填写）
+} zerolist_cnode_t;
+
+/**
+ * @struct zerolist_cqueue
+ * @brief 单向 FIFO 节点队列，也用作批量移动时的节点批次
+ */
+typedef struct zerolist_cqueue
+{
+    zerolist_cnode_t* head;   ///< 队首
+    zerolist_cnode_t* tail;   ///< 队尾
+    size_t            count;  ///< 节点数
+} zerolist_cqueue_t;
+
+/**
+ * @struct zerolist_chan
+ * @brief 回收通道：生产者 acquire → 填充 → submit，消费者 receive → 处理 → recycle
+ */
+typedef struct zerolist_chan
+{
+    zerolist_cnode_t* node_buf;   ///< 节点数组
+    size_t            max_nodes;  ///< 节点数
+    zerolist_cqueue_t free;       ///< 空闲缓冲区
+    zerolist_cqueue_t ready;      ///< 已填充、等待消费的缓冲区
+} zerolist_chan_t;
+
+/**
+ * @def ZEROLIST_CHAN_DEFINE(name, _count, _buf_size)
+ * @brief 定义静态通道：_count 个节点，每个节点一块 _buf_size 字节的缓冲区（按 8 字节对齐）
+ *
+ * 使用前需调用 ZEROLIST_CHAN_INIT(name)。
+ */
+#define ZEROLIST_CHAN_DEFINE(name, _count, _buf_size)                     \
+    static zerolist_cnode_t name##_nodes[(_count)];                       \
+    static uint64_t         name##_bufs[(_count)][((_buf_size) + 7) / 8]; \
+    static zerolist_chan_t  name
+#define ZEROLIST_CHAN_INIT(name)                                                    \
+    zerolist_chan_init(&(name), name##_nodes,                                       \
+                       sizeof(name##_nodes) / sizeof(name##_nodes[0]), name##_bufs, \
+                       sizeof(name##_bufs[0]))
+
+/**
+ * @def ZEROLIST_CQUEUE_FOR_EACH(queue_ptr, node_var)
+ * @brief 遍历节点批次（循环体内不可把 node_var 移入其他队列）
+ */
+#define ZEROLIST_CQUEUE_FOR_EACH(queue_ptr, node_var) \
+    for (zerolist_cnode_t* node_var = (queue_ptr)->head; node_var; node_var = node_var->next)
+
+/**
+ * @brief 初始化通道，所有节点进入空闲链
+ *
+ * @param nodes 节点数组
+ * @param count 节点数
+ * @param buffers 连续的缓冲区内存（count × buf_size 字节）；
+ *                为 NULL 时保留调用方预先写入各节点 data 的指针
+ * @param buf_size 每块缓冲区的字节数
+ * @return false 参数无效
+ */
+bool zerolist_chan_init(zerolist_chan_t* chan, zerolist_cnode_t* nodes, size_t count,
+                        void* buffers, size_t buf_size);
+
+/**
+ * @brief 生产者从空闲链取出一块缓冲区
+ *
+ * @return 节点（data 指向缓冲区），没有空闲缓冲区时返回 NULL
+ */
+zerolist_cnode_t* zerolist_chan_acquire(zerolist_chan_t* chan);
+
+/**
+ * @brief 生产者把填充好的缓冲区追加到就绪队列尾部
+ */
+void zerolist_chan_submit(zerolist_chan_t* chan, zerolist_cnode_t* node);
+
+/**
+ * @brief 消费者从就绪队列头部取出一块缓冲区
+ *
+ * @return 节点，就绪队列为空时返回 NULL
+ */
+zerolist_cnode_t* zerolist_chan_receive(zerolist_chan_t* chan);
+
+/**
+ * @brief 消费者把处理完的缓冲区归还空闲链
+ */
+void zerolist_chan_recycle(zerolist_chan_t* chan, zerolist_cnode_t* node);
+
+/**
+ * @brief 从空闲链一次取出至多 max 块缓冲区，追加到 batch 尾部
+ *
+ * @return 实际取出的块数
+ */
+size_t zerolist_chan_acquire_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch, size_t max);
+
+/**
+ * @brief 把整批缓冲区 O(1) 接到就绪队列尾部，batch 随后被清空
+ */
+void zerolist_chan_submit_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch);
+
+/**
+ * @brief O(1) 取走整条就绪队列，追加到 batch 尾部
+ *
+ * @return 取走的块数
+ */
+size_t zerolist_chan_receive_all(zerolist_chan_t* chan, zerolist_cqueue_t* batch);
+
+/**
+ * @brief 把整批缓冲区 O(1) 归还空闲链，batch 随后被清空
+ */
+void zerolist_chan_recycle_batch(zerolist_chan_t* chan, zerolist_cqueue_t* batch);
+
+/**
+ * @brief 从节点批次头部取出一个节点（不加锁，批次由调用方独占）
+ *
+ * @return 节点，批次为空时返回 NULL
+ */
+zerolist_cnode_t* zerolist_cqueue_pop(zerolist_cqueue_t* batch);
+
+/**
+ * @brief 空闲缓冲区数量
+ */
+size_t zerolist_chan_free_count(zerolist_chan_t* chan);
+
+/**
+ * @brief 就绪缓冲区数量
+ */
+size_t zerolist_chan_ready_count(zerolist_chan_t* chan);
+#endif  // ZEROLIST_CHAN_ENABLE
+
 #ifdef __cplusplus
 }
 #endif